@@ -0,0 +1,213 @@
+#if !defined(_WIN32)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "asset_pack.h"
+#include "raylib.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+// Precisa bater com tools/pack_assets.c
+#define PACK_MAGIC "MAGP"
+#define PACK_VERSION 1
+#define PACK_PATH_LENGTH 120
+#define PACK_HEADER_SIZE 16
+#define PACK_ENTRY_SIZE (PACK_PATH_LENGTH + 8)
+
+
+static const unsigned char *packData = NULL;
+static size_t packSize = 0;
+static uint32_t packEntryCount = 0;
+static bool packIsMapped = false;
+
+
+static uint32_t readU32(const unsigned char *bytes) {
+    return (uint32_t)bytes[0] | ((uint32_t)bytes[1] << 8) |
+           ((uint32_t)bytes[2] << 16) | ((uint32_t)bytes[3] << 24);
+}
+
+static const unsigned char *entryAt(uint32_t index) {
+    return packData + PACK_HEADER_SIZE + (size_t)index * PACK_ENTRY_SIZE;
+}
+
+// Valida cabeçalho e índice uma única vez na abertura, para que as buscas
+// depois não precisem checar limites de novo
+static bool validatePack(void) {
+    if (packSize < PACK_HEADER_SIZE || memcmp(packData, PACK_MAGIC, 4) != 0) return false;
+    if (readU32(packData + 4) != PACK_VERSION) return false;
+
+    packEntryCount = readU32(packData + 8);
+    if ((size_t)packEntryCount * PACK_ENTRY_SIZE > packSize - PACK_HEADER_SIZE) return false;
+
+    for (uint32_t i = 0; i < packEntryCount; i++) {
+        const unsigned char *entry = entryAt(i);
+        uint32_t offset = readU32(entry + PACK_PATH_LENGTH);
+        uint32_t size = readU32(entry + PACK_PATH_LENGTH + 4);
+
+        if (entry[PACK_PATH_LENGTH - 1] != '\0') return false;
+        if ((size_t)offset + size > packSize) return false;
+    }
+
+    return true;
+}
+
+bool OpenAssetPack(const char *fileName) {
+    if (packData != NULL) return true;
+
+#if defined(_WIN32)
+    // Sem mmap: carregar o pacote inteiro de uma vez (ainda é uma única abertura)
+    int size = 0;
+    unsigned char *data = LoadFileData(fileName, &size);
+    if (data == NULL) return false;
+
+    packData = data;
+    packSize = (size_t)size;
+    packIsMapped = false;
+#else
+    int fd = open(fileName, O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        close(fd);
+        return false;
+    }
+
+    void *mapped = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);  // O mapeamento continua válido após fechar o descritor
+    if (mapped == MAP_FAILED) return false;
+
+    packData = mapped;
+    packSize = (size_t)info.st_size;
+    packIsMapped = true;
+#endif
+
+    if (!validatePack()) {
+        printf("AVISO: Pacote de assets %s inválido, usando arquivos soltos\n", fileName);
+        CloseAssetPack();
+        return false;
+    }
+
+    printf("Pacote de assets %s aberto (%u arquivos)\n", fileName, packEntryCount);
+    return true;
+}
+
+void CloseAssetPack(void) {
+    if (packData == NULL) return;
+
+#if defined(_WIN32)
+    UnloadFileData((unsigned char *)packData);
+#else
+    if (packIsMapped) munmap((void *)packData, packSize);
+#endif
+
+    packData = NULL;
+    packSize = 0;
+    packEntryCount = 0;
+    packIsMapped = false;
+}
+
+bool IsAssetPackOpen(void) {
+    return packData != NULL;
+}
+
+const unsigned char *GetPackedAsset(const char *path, int *size) {
+    if (packData == NULL) return NULL;
+
+    // Busca binária no índice ordenado pelo caminho
+    uint32_t low = 0;
+    uint32_t high = packEntryCount;
+    while (low < high) {
+        uint32_t mid = low + (high - low) / 2;
+        const unsigned char *entry = entryAt(mid);
+        int cmp = strncmp(path, (const char *)entry, PACK_PATH_LENGTH);
+
+        if (cmp == 0) {
+            if (size) *size = (int)readU32(entry + PACK_PATH_LENGTH + 4);
+            return packData + readU32(entry + PACK_PATH_LENGTH);
+        }
+
+        if (cmp < 0) high = mid;
+        else low = mid + 1;
+    }
+
+    return NULL;
+}
+
+bool OpenAssetText(AssetTextReader *reader, const char *path) {
+    int size = 0;
+    const unsigned char *packed = GetPackedAsset(path, &size);
+    if (packed != NULL) {
+        OpenAssetTextBuffer(reader, path, (const char *)packed, size);
+        return true;
+    }
+
+    unsigned char *data = LoadFileData(path, &size);
+    if (data == NULL) return false;
+    OpenAssetTextBuffer(reader, path, (const char *)data, size);
+    reader->loadedData = data;
+    return true;
+}
+
+void OpenAssetTextBuffer(AssetTextReader *reader, const char *path, const char *text, int size) {
+    reader->path = path;
+    reader->text = text;
+    reader->size = size;
+    reader->offset = 0;
+    reader->lineNumber = 0;
+    reader->loadedData = NULL;
+    reader->line[0] = '\0';
+}
+
+static bool isLineSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+char *NextAssetLine(AssetTextReader *reader) {
+    while (reader->offset < reader->size) {
+        int lineStart = reader->offset;
+        int lineEnd = lineStart;
+        while (lineEnd < reader->size && reader->text[lineEnd] != '\n') lineEnd++;
+        reader->offset = lineEnd + 1;
+        reader->lineNumber++;
+
+        int length = lineEnd - lineStart;
+        if (length >= ASSET_LINE_LENGTH) length = ASSET_LINE_LENGTH - 1;
+        memcpy(reader->line, reader->text + lineStart, length);
+        reader->line[length] = '\0';
+
+        char *comment = strchr(reader->line, '#');
+        if (comment != NULL) {
+            *comment = '\0';
+            length = (int)(comment - reader->line);
+        }
+        while (length > 0 && isLineSpace(reader->line[length - 1])) reader->line[--length] = '\0';
+
+        char *line = reader->line;
+        while (isLineSpace(*line)) line++;
+        if (*line != '\0') return line;
+    }
+
+    return NULL;
+}
+
+bool RejectAssetLine(const AssetTextReader *reader, const char *fallback) {
+    printf("AVISO: %s linha %d inválida, usando %s\n", reader->path, reader->lineNumber, fallback);
+    return false;
+}
+
+void CloseAssetText(AssetTextReader *reader) {
+    if (reader->loadedData != NULL) UnloadFileData(reader->loadedData);
+    reader->loadedData = NULL;
+    reader->text = NULL;
+    reader->size = 0;
+}
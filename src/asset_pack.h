@@ -0,0 +1,44 @@
+#ifndef ASSET_PACK_H
+#define ASSET_PACK_H
+
+#include <stdbool.h>
+
+#define ASSET_PACK_FILE "assets.pak"
+
+// Abre o pacote de assets gerado por "make pack" e o mapeia em memória.
+// Se o pacote não existir, o jogo continua carregando os arquivos soltos.
+bool OpenAssetPack(const char *fileName);
+void CloseAssetPack(void);
+bool IsAssetPackOpen(void);
+
+// Retorna um ponteiro direto para os bytes do arquivo dentro do pacote
+// (sem cópia) ou NULL se o caminho não estiver empacotado.
+// O ponteiro é válido até CloseAssetPack().
+const unsigned char *GetPackedAsset(const char *path, int *size);
+
+// Leitura linha a linha dos assets de texto (padrões do boss, tabela de spawn,
+// manifesto de música). Cabe um caminho de música mais "=ext".
+#define ASSET_LINE_LENGTH 320
+
+typedef struct {
+    const char *path;             // nome usado nos avisos
+    const char *text;
+    int size;
+    int offset;
+    int lineNumber;
+    unsigned char *loadedData;    // arquivo solto lido com LoadFileData
+    char line[ASSET_LINE_LENGTH];
+} AssetTextReader;
+
+// Abre o texto do pacote ou, fora dele, o arquivo solto; false se não existir
+bool OpenAssetText(AssetTextReader *reader, const char *path);
+// Lê um texto que já está em memória (ex.: os padrões embutidos)
+void OpenAssetTextBuffer(AssetTextReader *reader, const char *path, const char *text, int size);
+// Próxima linha com conteúdo, sem o comentário ('#' até o fim) e sem espaços
+// nas pontas, ou NULL no fim. A linha vale até a próxima chamada.
+char *NextAssetLine(AssetTextReader *reader);
+// Avisa que a linha atual é inválida; devolve false para o parser repassar
+bool RejectAssetLine(const AssetTextReader *reader, const char *fallback);
+void CloseAssetText(AssetTextReader *reader);
+
+#endif
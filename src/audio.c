@@ -1,15 +1,109 @@
 #include "audio.h"
+#include "asset_pack.h"
 #include "raylib.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>  // Adicionado para função printf
 
+// Carrega um som do pacote de assets quando disponível, senão do disco
+static Sound loadGameSound(const char *fileName) {
+    int size = 0;
+    const unsigned char *data = GetPackedAsset(fileName, &size);
+    if (data == NULL) {
+        return LoadSound(fileName);
+    }
+
+    // O Wave decodifica direto da fatia mapeada; o Sound copia as amostras
+    // para o buffer de áudio, então o Wave pode ser liberado em seguida
+    Wave wave = LoadWaveFromMemory(GetFileExtension(fileName), data, size);
+    Sound sound = LoadSoundFromWave(wave);
+    UnloadWave(wave);
+    return sound;
+}
+
+// Formato escolhido por faixa, lido do manifesto gerado por "make music"
+typedef struct {
+    char path[MUSIC_PATH_LENGTH];
+    char ext[8];
+} MusicFormat;
+
+static MusicFormat musicFormats[MAX_MUSIC_FORMATS];
+static int musicFormatCount = 0;
+
+static bool musicAssetExists(const char *fileName) {
+    return GetPackedAsset(fileName, NULL) != NULL || FileExists(fileName);
+}
+
+// Uma linha "caminho=ext" por faixa; linhas fora desse formato são ignoradas
+static void parseMusicFormats(AssetTextReader *reader) {
+    char *line;
+    while (musicFormatCount < MAX_MUSIC_FORMATS && (line = NextAssetLine(reader)) != NULL) {
+        char *separator = strrchr(line, '=');
+        if (separator != NULL && separator - line < MUSIC_PATH_LENGTH && strlen(separator + 1) < 8) {
+            *separator = '\0';
+            MusicFormat *format = &musicFormats[musicFormatCount++];
+            strcpy(format->path, line);
+            strcpy(format->ext, separator + 1);
+        }
+    }
+}
+
+static void loadMusicFormats(void) {
+    musicFormatCount = 0;
+    
+    AssetTextReader reader;
+    if (OpenAssetText(&reader, MUSIC_FORMATS_FILE)) {
+        parseMusicFormats(&reader);
+        CloseAssetText(&reader);
+    }
+}
+
+// Escolhe qual variante da faixa carregar: a indicada no manifesto, senão a
+// primeira comprimida disponível (QOA decodifica mais barato que OGG), senão o .wav
+static const char *resolveMusicFile(const char *fileName) {
+    static char resolved[MUSIC_PATH_LENGTH];
+    static const char *fallbackExts[] = { "qoa", "ogg" };
+    
+    const char *dot = strrchr(fileName, '.');
+    int baseLength = dot ? (int)(dot - fileName) : (int)strlen(fileName);
+    if (baseLength + 5 >= MUSIC_PATH_LENGTH) return fileName;
+    
+    for (int i = 0; i < musicFormatCount; i++) {
+        if (strcmp(musicFormats[i].path, fileName) == 0) {
+            snprintf(resolved, sizeof(resolved), "%.*s.%s", baseLength, fileName, musicFormats[i].ext);
+            if (musicAssetExists(resolved)) return resolved;
+            break;
+        }
+    }
+    
+    for (int i = 0; i < 2; i++) {
+        snprintf(resolved, sizeof(resolved), "%.*s.%s", baseLength, fileName, fallbackExts[i]);
+        if (musicAssetExists(resolved)) return resolved;
+    }
+    
+    return fileName;
+}
+
+// Carrega uma música do pacote de assets quando disponível, senão do disco.
+// O stream lê direto da memória mapeada, que fica válida até CloseAssetPack()
+static Music loadGameMusic(const char *fileName) {
+    fileName = resolveMusicFile(fileName);
+    
+    int size = 0;
+    const unsigned char *data = GetPackedAsset(fileName, &size);
+    if (data == NULL) {
+        return LoadMusicStream(fileName);
+    }
+
+    return LoadMusicStreamFromMemory(GetFileExtension(fileName), data, size);
+}
+
 void LoadGameAudio(Sound *shoot, Sound *enemyExplode, Sound *playerExplode, 
                  Sound *enemyNormalDeath, Sound *enemyTankDeath, 
                  Sound *enemyExploderDeath, Sound *enemyShooterDeath,
                  Sound *dashSound, // Novo parâmetro
                  Music *bgMusic, Music *menuMusic, Music *tutorialMusic, 
-                 Music *pauseMusic, Music *gameOverMusic, Music *nameEntryMusic,
+                 Music *nameEntryMusic,
                  Music *bossMusic, // Novo parâmetro
                  Sound *menuClick, Sound *powerupDamageSound, Sound *powerupHealSound, Sound *powerupShieldSound) {
     // Inicializar o sistema de áudio
@@ -36,59 +130,57 @@ void LoadGameAudio(Sound *shoot, Sound *enemyExplode, Sound *playerExplode,
     *bgMusic = (Music){0};
     *menuMusic = (Music){0};
     *tutorialMusic = (Music){0};
-    *pauseMusic = (Music){0};
-    *gameOverMusic = (Music){0};
     *nameEntryMusic = (Music){0};
     *bossMusic = (Music){0}; // Inicializar a música do boss
     
+    // Abrir o pacote de assets (uma única abertura de arquivo para todos os sons)
+    OpenAssetPack(ASSET_PACK_FILE);
+    loadMusicFormats();
+    
     // Carregar efeitos sonoros básicos
-    *shoot = LoadSound("assets/sounds/Player/Tiro.wav");
-    *enemyExplode = LoadSound("assets/sounds/Inimigo/Explode.wav");
-    *playerExplode = LoadSound("assets/sounds/Player/Sofrer dano.wav");
-    *dashSound = LoadSound("assets/sounds/Player/Dash.wav"); // Carregando o som do dash
+    *shoot = loadGameSound("assets/sounds/Player/Tiro.wav");
+    *enemyExplode = loadGameSound("assets/sounds/Inimigo/Explode.wav");
+    *playerExplode = loadGameSound("assets/sounds/Player/Sofrer dano.wav");
+    *dashSound = loadGameSound("assets/sounds/Player/Dash.wav"); // Carregando o som do dash
     
     // Carregar sons específicos para cada tipo de inimigo
-    *enemyNormalDeath = LoadSound("assets/sounds/Inimigo/MorteSimples.wav");
-    *enemyTankDeath = LoadSound("assets/sounds/Inimigo/MorteTanker.wav");
-    *enemyExploderDeath = LoadSound("assets/sounds/Inimigo/Explode.wav");
-    *enemyShooterDeath = LoadSound("assets/sounds/Inimigo/Shooter.wav");
+    *enemyNormalDeath = loadGameSound("assets/sounds/Inimigo/MorteSimples.wav");
+    *enemyTankDeath = loadGameSound("assets/sounds/Inimigo/MorteTanker.wav");
+    *enemyExploderDeath = loadGameSound("assets/sounds/Inimigo/Explode.wav");
+    *enemyShooterDeath = loadGameSound("assets/sounds/Inimigo/Shooter.wav");
     
     // Carregar sons da interface
-    *menuClick = LoadSound("assets/music/Click_Menu.wav");
+    *menuClick = loadGameSound("assets/music/Click_Menu.wav");
     
     // Carregar sons diferentes para cada powerup
-    *powerupDamageSound = LoadSound("assets/sounds/Power up/O vermelho.wav");
-    *powerupHealSound = LoadSound("assets/sounds/Power up/Livup.wav");
-    *powerupShieldSound = LoadSound("assets/sounds/Power up/Shield.wav");
+    *powerupDamageSound = loadGameSound("assets/sounds/Power up/O vermelho.wav");
+    *powerupHealSound = loadGameSound("assets/sounds/Power up/Livup.wav");
+    *powerupShieldSound = loadGameSound("assets/sounds/Power up/Shield.wav");
     
     // Carregar músicas para os diferentes estados
-    *bgMusic = LoadMusicStream("assets/music/Soundtrack Options/Loop 2.wav");
-    *menuMusic = LoadMusicStream("assets/music/Soundtrack Options/Space Station Intro.wav");
-    *tutorialMusic = LoadMusicStream("assets/music/Soundtrack Options/Space Station Intro.wav");
-    *pauseMusic = LoadMusicStream("assets/music/Soundtrack Options/Loop 2.wav");
-    *gameOverMusic = LoadMusicStream("assets/music/Soundtrack Options/Loop 2.wav");
-    *nameEntryMusic = LoadMusicStream("assets/music/Soundtrack Options/Loop 2.wav");
+    *bgMusic = loadGameMusic("assets/music/Soundtrack Options/Loop 2.wav");
+    *menuMusic = loadGameMusic("assets/music/Soundtrack Options/Space Station Intro.wav");
+    *tutorialMusic = loadGameMusic("assets/music/Soundtrack Options/Space Station Intro.wav");
+    *nameEntryMusic = loadGameMusic("assets/music/Soundtrack Options/Loop 2.wav");
     
     // Carregar música do boss
-    *bossMusic = LoadMusicStream("assets/music/Soundtrack Options/Fast and Furious BG loop by Dirtyflint.wav");
+    *bossMusic = loadGameMusic("assets/music/Soundtrack Options/Fast and Furious BG loop by Dirtyflint.wav");
     
     // Verificar e configurar volumes (adicionando verificações de segurança)
     printf("Configurando volumes de sons...\n");
     
     // Configurar volumes das músicas de forma segura
     if (menuMusic->ctxData != NULL) {
-        SetMusicVolume(*menuMusic, 0.5f);
+        SetMusicVolume(*menuMusic, MUSIC_VOLUME_MENU);
         printf("Volume da música do menu configurado\n");
     } else {
         printf("AVISO: Música do menu não carregada corretamente!\n");
     }
     
-    if (bgMusic->ctxData != NULL) SetMusicVolume(*bgMusic, 0.4f);
-    if (tutorialMusic->ctxData != NULL) SetMusicVolume(*tutorialMusic, 0.5f);
-    if (pauseMusic->ctxData != NULL) SetMusicVolume(*pauseMusic, 0.3f);
-    if (gameOverMusic->ctxData != NULL) SetMusicVolume(*gameOverMusic, 0.4f);
-    if (nameEntryMusic->ctxData != NULL) SetMusicVolume(*nameEntryMusic, 0.4f);
-    if (bossMusic->ctxData != NULL) SetMusicVolume(*bossMusic, 0.85f); // Volume aumentado para 85%
+    if (bgMusic->ctxData != NULL) SetMusicVolume(*bgMusic, MUSIC_VOLUME_GAMEPLAY);
+    if (tutorialMusic->ctxData != NULL) SetMusicVolume(*tutorialMusic, MUSIC_VOLUME_MENU);
+    if (nameEntryMusic->ctxData != NULL) SetMusicVolume(*nameEntryMusic, MUSIC_VOLUME_NAME_ENTRY);
+    if (bossMusic->ctxData != NULL) SetMusicVolume(*bossMusic, MUSIC_VOLUME_BOSS); // Volume aumentado para 85%
     
     // Configurar volumes dos sons de forma segura
     if (shoot->frameCount > 0) SetSoundVolume(*shoot, 0.7f);
@@ -116,7 +208,7 @@ void UnloadGameAudio(Sound shoot, Sound enemyExplode, Sound playerExplode,
                     Sound enemyExploderDeath, Sound enemyShooterDeath,
                     Sound dashSound, // Novo parâmetro
                     Music bgMusic, Music menuMusic, Music tutorialMusic, 
-                    Music pauseMusic, Music gameOverMusic, Music nameEntryMusic,
+                    Music nameEntryMusic,
                     Music bossMusic, // Novo parâmetro
                     Sound menuClick, Sound powerupDamageSound, Sound powerupHealSound, Sound powerupShieldSound) {
     // Descarregar sons básicos
@@ -134,8 +226,6 @@ void UnloadGameAudio(Sound shoot, Sound enemyExplode, Sound playerExplode,
     UnloadMusicStream(bgMusic);
     UnloadMusicStream(menuMusic);
     UnloadMusicStream(tutorialMusic);
-    UnloadMusicStream(pauseMusic);
-    UnloadMusicStream(gameOverMusic);
     UnloadMusicStream(nameEntryMusic);
     UnloadMusicStream(bossMusic); // Adicione esta linha
     
@@ -145,6 +235,9 @@ void UnloadGameAudio(Sound shoot, Sound enemyExplode, Sound playerExplode,
     UnloadSound(powerupHealSound);
     UnloadSound(powerupShieldSound);
     UnloadSound(dashSound); // Descarregar o som do dash
+    
+    // Os streams de música já foram descarregados, o pacote pode ser fechado
+    CloseAssetPack();
 }
 
 void PlayGameSound(Sound sound) {
@@ -153,8 +246,131 @@ void PlayGameSound(Sound sound) {
     }
 }
 
-void UpdateGameMusicStream(Music music) {
+void RewindGameMusic(Music music) {
     if (IsAudioDeviceReady() && music.ctxData != NULL) {
-        UpdateMusicStream(music);
+        SeekMusicStream(music, 0.0f);
     }
 }
+
+
+static bool isMusicLoaded(const Music *music) {
+    return music != NULL && music->ctxData != NULL && IsAudioDeviceReady();
+}
+
+// Retira a faixa da lista de pausadas; retorna true se ela estava lá
+static bool takePausedTrack(MusicDirector *director, Music *music) {
+    for (int i = 0; i < director->pausedCount; i++) {
+        if (director->pausedTracks[i] == music) {
+            director->pausedTracks[i] = director->pausedTracks[--director->pausedCount];
+            return true;
+        }
+    }
+    return false;
+}
+
+static void pauseTrack(MusicDirector *director, Music *music) {
+    if (!isMusicLoaded(music)) return;
+    
+    PauseMusicStream(*music);
+    takePausedTrack(director, music);  // Evitar entradas duplicadas
+    if (director->pausedCount < MAX_PAUSED_TRACKS) {
+        director->pausedTracks[director->pausedCount++] = music;
+    }
+}
+
+// Fração do fade já percorrida por um dos temporizadores do diretor
+static float fadeProgress(const MusicDirector *director, float timer) {
+    float t = timer / director->fadeDuration;
+    return (t > 1.0f) ? 1.0f : t;
+}
+
+// Volumes que as faixas estão tocando agora (o fade pode estar no meio)
+static float currentTrackVolume(const MusicDirector *director) {
+    float t = fadeProgress(director, director->volumeTimer);
+    return director->currentStartVolume + (director->currentVolume - director->currentStartVolume) * t;
+}
+
+static float previousTrackVolume(const MusicDirector *director) {
+    return director->previousVolume * (1.0f - fadeProgress(director, director->fadeTimer));
+}
+
+void InitMusicDirector(MusicDirector *director) {
+    memset(director, 0, sizeof(MusicDirector));
+    director->fadeDuration = MUSIC_CROSSFADE_TIME;
+}
+
+void PlayDirectedMusic(MusicDirector *director, Music *music, float volume) {
+    if (music == director->current) {
+        // Mesma faixa: só ajusta o volume alvo (ex.: pausa abaixa a música do jogo).
+        // A faixa que estiver saindo continua o próprio fade.
+        if (volume != director->currentVolume) {
+            director->currentStartVolume = currentTrackVolume(director);
+            director->currentVolume = volume;
+            director->volumeTimer = 0.0f;
+        }
+        return;
+    }
+    
+    // A faixa que saía de cena volta a ser a principal: inverter o fade sem
+    // reiniciar, partindo do volume em que cada uma está
+    if (music == director->previous) {
+        float returningVolume = previousTrackVolume(director);
+        director->previousVolume = currentTrackVolume(director);
+        director->previous = director->current;
+        director->fadeTimer = 0.0f;
+        
+        director->current = music;
+        director->currentStartVolume = returningVolume;
+        director->currentVolume = volume;
+        director->volumeTimer = 0.0f;
+        return;
+    }
+    
+    // Um terceiro stream não entra no mix: a faixa que já estava saindo é pausada
+    if (director->previous != NULL) {
+        pauseTrack(director, director->previous);
+    }
+    
+    director->previous = director->current;
+    director->previousVolume = currentTrackVolume(director);
+    director->fadeTimer = 0.0f;
+    
+    director->current = music;
+    director->currentStartVolume = 0.0f;
+    director->currentVolume = volume;
+    director->volumeTimer = 0.0f;
+    
+    if (isMusicLoaded(music)) {
+        SetMusicVolume(*music, 0.0f);
+        if (takePausedTrack(director, music)) {
+            ResumeMusicStream(*music);
+        } else {
+            PlayMusicStream(*music);
+        }
+    }
+}
+
+void UpdateMusicDirector(MusicDirector *director, float deltaTime) {
+    if (director->volumeTimer < director->fadeDuration) {
+        director->volumeTimer += deltaTime;
+        if (isMusicLoaded(director->current)) {
+            SetMusicVolume(*director->current, currentTrackVolume(director));
+        }
+    }
+    
+    if (director->previous != NULL) {
+        director->fadeTimer += deltaTime;
+        if (isMusicLoaded(director->previous)) {
+            SetMusicVolume(*director->previous, previousTrackVolume(director));
+        }
+        
+        if (director->fadeTimer >= director->fadeDuration) {
+            pauseTrack(director, director->previous);
+            director->previous = NULL;
+        }
+    }
+    
+    // Apenas os streams audíveis são alimentados
+    if (isMusicLoaded(director->current)) UpdateMusicStream(*director->current);
+    if (isMusicLoaded(director->previous)) UpdateMusicStream(*director->previous);
+}
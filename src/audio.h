@@ -3,12 +3,43 @@
 
 #include "raylib.h"
 
+// Manifesto com o formato (wav/ogg/qoa) escolhido para cada faixa de música
+#define MUSIC_FORMATS_FILE "assets/music/music_formats.txt"
+#define MAX_MUSIC_FORMATS 32
+#define MUSIC_PATH_LENGTH 256
+
+// Volume base de cada faixa
+#define MUSIC_VOLUME_GAMEPLAY 0.4f
+#define MUSIC_VOLUME_MENU 0.5f
+#define MUSIC_VOLUME_PAUSE 0.15f
+#define MUSIC_VOLUME_NAME_ENTRY 0.4f
+#define MUSIC_VOLUME_BOSS 0.85f
+
+#define MUSIC_CROSSFADE_TIME 0.8f
+#define MAX_PAUSED_TRACKS 8
+
+// Diretor de música: no máximo dois streams ativos (o que entra e o que sai),
+// trocados por crossfade. Faixas que saem são pausadas, não paradas, para
+// voltarem do mesmo ponto sem reposicionar o stream.
+typedef struct {
+    Music *current;
+    Music *previous;
+    float currentVolume;       // Volume alvo da faixa atual
+    float currentStartVolume;  // Volume real da faixa atual quando a mudança começou
+    float volumeTimer;         // Progresso da faixa atual até currentVolume
+    float previousVolume;      // Volume da faixa que está saindo no início do fade
+    float fadeTimer;           // Progresso da saída da faixa anterior
+    float fadeDuration;
+    Music *pausedTracks[MAX_PAUSED_TRACKS];
+    int pausedCount;
+} MusicDirector;
+
 void LoadGameAudio(Sound *shoot, Sound *enemyExplode, Sound *playerExplode, 
                  Sound *enemyNormalDeath, Sound *enemyTankDeath, 
                  Sound *enemyExploderDeath, Sound *enemyShooterDeath,
                  Sound *dashSound, // Adicione esta linha
                  Music *bgMusic, Music *menuMusic, Music *tutorialMusic, 
-                 Music *pauseMusic, Music *gameOverMusic, Music *nameEntryMusic,
+                 Music *nameEntryMusic,
                  Music *bossMusic,
                  Sound *menuClick, Sound *powerupDamageSound, Sound *powerupHealSound, Sound *powerupShieldSound);
 
@@ -17,11 +48,16 @@ void UnloadGameAudio(Sound shoot, Sound enemyExplode, Sound playerExplode,
                     Sound enemyExploderDeath, Sound enemyShooterDeath,
                     Sound dashSound, // Adicione esta linha
                     Music bgMusic, Music menuMusic, Music tutorialMusic, 
-                    Music pauseMusic, Music gameOverMusic, Music nameEntryMusic,
+                    Music nameEntryMusic,
                     Music bossMusic,
                     Sound menuClick, Sound powerupDamageSound, Sound powerupHealSound, Sound powerupShieldSound);
 
 void PlayGameSound(Sound sound);
-void UpdateGameMusicStream(Music music);
+// Volta a faixa ao início (uma nova partida não continua a música do meio)
+void RewindGameMusic(Music music);
+
+void InitMusicDirector(MusicDirector *director);
+void PlayDirectedMusic(MusicDirector *director, Music *music, float volume);
+void UpdateMusicDirector(MusicDirector *director, float deltaTime);
 
 #endif
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "raymath.h"
 #include "utils.h"
 #include "render.h"
+#include "direction_table.h"
 #include <stdlib.h>
 #include <math.h>
 
@@ -15,11 +16,6 @@
 #define BOSS_LAYER2_HEALTH 150.0f 
 #define BOSS_LAYER1_HEALTH 200.0f 
 
-#define BOSS_ATTACK_INTERVAL_LAYER4 3.0f
-#define BOSS_ATTACK_INTERVAL_LAYER3 2.0f
-#define BOSS_ATTACK_INTERVAL_LAYER2 1.0f
-#define BOSS_ATTACK_INTERVAL_LAYER1 0.5f
-
 #define BOSS_DASH_COOLDOWN 3.0f
 #define BOSS_DASH_DURATION 0.3f
 #define BOSS_DASH_SPEED 800.0f
@@ -31,7 +27,6 @@ void InitBoss(Boss *boss, Vector2 position) {
     boss->currentLayer = 4; 
     boss->layerHealth = BOSS_LAYER4_HEALTH;
     boss->maxLayerHealth = BOSS_LAYER4_HEALTH;
-    boss->attackTimer = 0.0f;
     boss->active = true;
     boss->isTransitioning = false;
     boss->transitionTimer = 0.0f;
@@ -42,15 +37,14 @@ void InitBoss(Boss *boss, Vector2 position) {
     boss->dashTimer = 0.0f;
     boss->dashCooldown = 0.0f;
     boss->targetPosition = position;
+    
+    ResetBossPattern(&boss->pattern, 0);
 }
 
-void UpdateBoss(Boss *boss, Vector2 playerPosition, float deltaTime, Bullet **enemyBullets) {
+void UpdateBoss(Boss *boss, Vector2 playerPosition, float deltaTime, BulletList *enemyBullets) {
     if (!boss->active) return;
     
     
-    boss->attackTimer += deltaTime;
-    
-    
     if (boss->isTransitioning) {
         boss->transitionTimer += deltaTime;
         
@@ -88,145 +82,69 @@ void UpdateBoss(Boss *boss, Vector2 playerPosition, float deltaTime, Bullet **en
     }
     
     
-    Vector2 direction = Vector2Normalize(Vector2Subtract(playerPosition, boss->position));
-    
+    Vector2 toPlayer = Vector2Subtract(playerPosition, boss->position);
+    float distanceToPlayer = Vector2Length(toPlayer);
+    Vector2 direction = Vector2Normalize(toPlayer);
     
-    switch (boss->currentLayer) {
-        case 4: 
-            
-            boss->position = Vector2Add(boss->position, 
-                                      Vector2Scale(direction, BOSS_BASE_SPEED * 0.5f * deltaTime));
-            
-            
-            if (boss->attackTimer >= BOSS_ATTACK_INTERVAL_LAYER4) {
-                boss->attackTimer = 0.0f;
-                
-                
-                AddBullet(enemyBullets, boss->position, direction, false);
-            }
-            break;
-            
-        case 3: 
-            
-            direction.x += (float)GetRandomValue(-50, 50) / 100.0f;
-            direction.y += (float)GetRandomValue(-50, 50) / 100.0f;
-            direction = Vector2Normalize(direction);
-            
-            
-            boss->position = Vector2Add(boss->position, 
-                                      Vector2Scale(direction, BOSS_BASE_SPEED * 0.7f * deltaTime));
-            
-            
-            if (boss->attackTimer >= BOSS_ATTACK_INTERVAL_LAYER3) {
-                boss->attackTimer = 0.0f;
-                
-                
-                for (int i = 0; i < 8; i++) {
-                    float angle = i * (2.0f * PI / 8.0f);
-                    Vector2 bulletDir = {cosf(angle), sinf(angle)};
-                    AddBullet(enemyBullets, boss->position, bulletDir, false);
-                }
-            }
-            break;
-            
-        case 2: 
-            
-            boss->position = Vector2Add(boss->position, 
-                                      Vector2Scale(direction, BOSS_BASE_SPEED * 0.9f * deltaTime));
-            
-            
-            if (boss->attackTimer >= BOSS_ATTACK_INTERVAL_LAYER2) {
-                boss->attackTimer = 0.0f;
-                
-                
-                float baseAngle = atan2f(direction.y, direction.x);
-                
-                
-                for (int i = -1; i <= 1; i++) {
-                    float angle = baseAngle + i * (PI / 4.0f);
-                    Vector2 bulletDir = {cosf(angle), sinf(angle)};
-                    AddBullet(enemyBullets, boss->position, bulletDir, false);
-                }
-                
+    // Movimento: a investida vale para qualquer camada; fora dela, o modo da camada
+    if (boss->isDashing) {
+        boss->position = Vector2Add(boss->position, 
+                                    Vector2Scale(boss->dashDirection, BOSS_DASH_SPEED * deltaTime));
+        
+        boss->dashTimer -= deltaTime;
+        if (boss->dashTimer <= 0) {
+            boss->isDashing = false;
+            boss->dashCooldown = BOSS_DASH_COOLDOWN;
+        }
+    } else {
+        BossMovement movement = GetBossMovement(boss->currentLayer);
+        float speed = BOSS_BASE_SPEED * movement.speedFactor;
+        
+        switch (movement.mode) {
+            case BOSS_MOVE_CHASE:
+                boss->position = Vector2Add(boss->position, Vector2Scale(direction, speed * deltaTime));
+                break;
                 
-                if (boss->layerHealth < boss->maxLayerHealth / 2.0f && GetRandomValue(0, 100) < 20) {
-                    
-                    float teleportDistance = Vector2Distance(playerPosition, boss->position) * 0.7f;
-                    boss->position = Vector2Add(boss->position, Vector2Scale(direction, teleportDistance));
-                    
-                    
-                    for (int i = 0; i < 12; i++) {
-                        float angle = i * (2.0f * PI / 12.0f);
-                        Vector2 bulletDir = {cosf(angle), sinf(angle)};
-                        AddBullet(enemyBullets, boss->position, bulletDir, false);
-                    }
-                }
+            case BOSS_MOVE_JITTER: {
+                Vector2 jittered = direction;
+                jittered.x += (float)GetRandomValue(-50, 50) / 100.0f;
+                jittered.y += (float)GetRandomValue(-50, 50) / 100.0f;
+                jittered = Vector2Normalize(jittered);
+                boss->position = Vector2Add(boss->position, Vector2Scale(jittered, speed * deltaTime));
+                break;
             }
-            break;
-            
-        case 1: 
-            
-            if (boss->isDashing) {
-                
-                boss->position = Vector2Add(boss->position, 
-                                         Vector2Scale(boss->dashDirection, BOSS_DASH_SPEED * deltaTime));
-                
-                boss->dashTimer -= deltaTime;
-                if (boss->dashTimer <= 0) {
-                    boss->isDashing = false;
-                    boss->dashCooldown = BOSS_DASH_COOLDOWN;
-                    
-                    
-                    for (int i = 0; i < 16; i++) {
-                        float angle = i * (2.0f * PI / 16.0f);
-                        Vector2 bulletDir = {cosf(angle), sinf(angle)};
-                        AddBullet(enemyBullets, boss->position, bulletDir, false);
-                    }
-                }
-            } else {
                 
+            case BOSS_MOVE_WANDER: {
                 if (GetRandomValue(0, 100) < 2) { 
-                    float angle = GetRandomValue(0, 360) * DEG2RAD;
+                    Vector2 offset = DirectionFromAngle(AngleFromDegrees(GetRandomValue(0, 360)));
                     float distance = GetRandomValue(100, 300);
-                    boss->targetPosition = Vector2Add(playerPosition, 
-                                                    (Vector2){cosf(angle) * distance, sinf(angle) * distance});
+                    boss->targetPosition = Vector2Add(playerPosition, Vector2Scale(offset, distance));
                 }
                 
-                
                 Vector2 toTarget = Vector2Subtract(boss->targetPosition, boss->position);
-                float distToTarget = Vector2Length(toTarget);
-                
-                if (distToTarget > 5.0f) {
-                    Vector2 moveDir = Vector2Normalize(toTarget);
+                if (Vector2Length(toTarget) > 5.0f) {
                     boss->position = Vector2Add(boss->position, 
-                                             Vector2Scale(moveDir, BOSS_BASE_SPEED * 1.2f * deltaTime));
-                }
-                
-                
-                if (boss->attackTimer >= BOSS_ATTACK_INTERVAL_LAYER1) {
-                    boss->attackTimer = 0.0f;
-                    
-                    
-                    float baseAngle = atan2f(direction.y, direction.x);
-                    for (int i = -2; i <= 2; i++) {
-                        float angle = baseAngle + i * (PI / 12.0f);
-                        Vector2 bulletDir = {cosf(angle), sinf(angle)};
-                        AddBullet(enemyBullets, boss->position, bulletDir, false);
-                    }
-                }
-                
-                
-                if (boss->dashCooldown <= 0 && 
-                    Vector2Distance(boss->position, playerPosition) > 200 &&
-                    Vector2Distance(boss->position, playerPosition) < 500) {
-                    boss->isDashing = true;
-                    boss->dashTimer = BOSS_DASH_DURATION;
-                    boss->dashDirection = direction;
+                                             Vector2Scale(Vector2Normalize(toTarget), speed * deltaTime));
                 }
+                break;
             }
-            break;
+        }
     }
     
+    // Ataques: os programas da camada decidem quando atirar, teleportar e investir
+    BossPatternContext context = {
+        .position = &boss->position,
+        .aim = direction,
+        .distanceToPlayer = distanceToPlayer,
+        .healthFraction = (boss->maxLayerHealth > 0.0f) ? boss->layerHealth / boss->maxLayerHealth : 1.0f,
+        .isDashing = &boss->isDashing,
+        .dashTimer = &boss->dashTimer,
+        .dashCooldown = boss->dashCooldown,
+        .dashDuration = BOSS_DASH_DURATION,
+        .dashDirection = &boss->dashDirection
+    };
+    RunBossPattern(&boss->pattern, boss->currentLayer, &context, deltaTime, enemyBullets);
+    
     
     extern float currentPlayAreaRadius;
     Vector2 centerToPos = Vector2Subtract(boss->position, 
@@ -260,19 +178,14 @@ bool CheckBossHitByBullet(Boss *boss, Vector2 bulletPosition, float bulletRadius
     return false; // Sem colisão
 }
 
-void LaunchRicochetBullets(Boss *boss, Bullet **enemyBullets) {
+void LaunchRicochetBullets(Boss *boss, BulletList *enemyBullets) {
     int numBullets = 8;  
     if (boss->currentLayer == 1) {
         numBullets = 12; 
     }
     
-    for (int i = 0; i < numBullets; i++) {
-        float angle = i * (2.0f * PI / numBullets);
-        Vector2 bulletDir = {cosf(angle), sinf(angle)};
-        
-        
-        AddRicochetBullet(enemyBullets, boss->position, bulletDir);
-    }
+    EmitBullets(enemyBullets, GetBulletArchetype(BULLET_KIND_RICOCHET), BULLET_NO_MODIFIERS,
+                boss->position, GetDirectionRing(numBullets), numBullets);
 }
 
 void DrawBoss(const Boss *boss) {
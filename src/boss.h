@@ -4,6 +4,7 @@
 #include "raylib.h"
 #include "enemy.h"
 #include "bullet.h"
+#include "boss_pattern.h"
 
 
 // Saúde do boss por camada
@@ -23,7 +24,6 @@ typedef struct {
     int currentLayer;      
     float layerHealth;     
     float maxLayerHealth;  
-    float attackTimer;     
     bool active;           
     bool isTransitioning;  
     float transitionTimer; 
@@ -34,19 +34,22 @@ typedef struct {
     float dashTimer;       
     float dashCooldown;    
     Vector2 targetPosition; 
+    
+    // Programas de ataque da camada atual (assets/boss_patterns.txt)
+    BossPatternState pattern;
 } Boss;
 
 
 void InitBoss(Boss *boss, Vector2 position);
 
 
-void UpdateBoss(Boss *boss, Vector2 playerPosition, float deltaTime, Bullet **enemyBullets);
+void UpdateBoss(Boss *boss, Vector2 playerPosition, float deltaTime, BulletList *enemyBullets);
 
 
 bool CheckBossHitByBullet(Boss *boss, Vector2 bulletPosition, float bulletRadius, int damage);
 
 
-void LaunchRicochetBullets(Boss *boss, Bullet **enemyBullets);
+void LaunchRicochetBullets(Boss *boss, BulletList *enemyBullets);
 
 
 void DrawBoss(const Boss *boss);
@@ -0,0 +1,363 @@
+#include "boss_pattern.h"
+#include "asset_pack.h"
+#include "direction_table.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+
+// Bytecode: uma operação ocupa 16 bytes e aponta para as direções já calculadas
+typedef enum {
+    PATTERN_OP_WAIT = 0,     // value = segundos
+    PATTERN_OP_EMIT,         // um tiro mirado no jogador
+    PATTERN_OP_RING,         // count balas em círculo; value = giro por execução (graus)
+    PATTERN_OP_FAN,          // count balas abertas em volta da mira; value = espaçamento (graus)
+    PATTERN_OP_DASH,         // value/value2 = distância mínima/máxima para investir
+    PATTERN_OP_TELEPORT,     // salta value da distância até o jogador
+    PATTERN_OP_HEALTH_BELOW, // pula count operações se a vida não estiver abaixo de value
+    PATTERN_OP_CHANCE        // pula count operações se o sorteio (value %) falhar
+} PatternOpcode;
+
+typedef struct {
+    unsigned char opcode;
+    unsigned char count;
+    unsigned short table;    // primeira direção em directionPool
+    float value;
+    float value2;
+} PatternOp;
+
+typedef struct {
+    PatternOp ops[BOSS_PATTERN_MAX_OPS];
+    int opCount;
+} PatternProgram;
+
+typedef struct {
+    BossMovement movement;
+    PatternProgram programs[BOSS_PATTERN_THREADS];
+    int programCount;
+} PatternLayer;
+
+
+// Os mesmos ataques que o boss tinha escritos em C antes dos padrões em arquivo
+static const char *builtinPatterns =
+    "layer 4 chase 0.5\n"
+    "program\n"
+    "wait 3\n"
+    "emit\n"
+    "layer 3 jitter 0.7\n"
+    "program\n"
+    "wait 2\n"
+    "ring 8\n"
+    "layer 2 chase 0.9\n"
+    "program\n"
+    "wait 1\n"
+    "fan 3 45\n"
+    "health_below 0.5 3\n"
+    "chance 20 2\n"
+    "teleport 0.7\n"
+    "ring 12\n"
+    "layer 1 wander 1.2\n"
+    "program\n"
+    "wait 0.5\n"
+    "fan 5 15\n"
+    "program\n"
+    "dash 200 500\n"
+    "ring 16\n";
+
+static PatternLayer layers[BOSS_PATTERN_LAYERS];
+
+// Anéis guardam os vetores unitários; leques guardam rotações relativas à mira.
+// Um anel giratório guarda ainda a rotação do passo logo depois das balas.
+static Vector2 directionPool[BOSS_PATTERN_DIRECTIONS];
+static int directionCount = 0;
+
+static Vector2 burst[BOSS_PATTERN_MAX_BURST];
+
+
+static bool reserveDirections(int count, unsigned short *table) {
+    if (directionCount + count > BOSS_PATTERN_DIRECTIONS) return false;
+    
+    *table = (unsigned short)directionCount;
+    directionCount += count;
+    return true;
+}
+
+static bool rejectPatternLine(const AssetTextReader *reader) {
+    return RejectAssetLine(reader, "os padrões embutidos");
+}
+
+static float nextNumber(bool *ok) {
+    char *token = strtok(NULL, " \t\r");
+    if (token == NULL) {
+        *ok = false;
+        return 0.0f;
+    }
+    return strtof(token, NULL);
+}
+
+// Compila uma operação; as direções saem daqui prontas e nunca mais usam cos/sin
+static bool compileOp(const char *name, PatternOp *op) {
+    bool ok = true;
+    memset(op, 0, sizeof(PatternOp));
+    
+    if (strcmp(name, "wait") == 0) {
+        op->opcode = PATTERN_OP_WAIT;
+        op->value = nextNumber(&ok);
+        return ok && op->value > 0.0f;
+    }
+    
+    if (strcmp(name, "emit") == 0) {
+        op->opcode = PATTERN_OP_EMIT;
+        op->count = 1;
+        if (!reserveDirections(1, &op->table)) return false;
+        directionPool[op->table] = (Vector2){ 1.0f, 0.0f };
+        return true;
+    }
+    
+    if (strcmp(name, "ring") == 0 || strcmp(name, "fan") == 0) {
+        bool ring = (name[0] == 'r');
+        int count = (int)nextNumber(&ok);
+        if (!ok || count < 1 || count > BOSS_PATTERN_MAX_BURST) return false;
+        
+        // Giro do anel é opcional; o espaçamento do leque não
+        char *token = strtok(NULL, " \t\r");
+        if (token == NULL && !ring) return false;
+        float degrees = (token != NULL) ? strtof(token, NULL) : 0.0f;
+        
+        op->opcode = ring ? PATTERN_OP_RING : PATTERN_OP_FAN;
+        op->count = (unsigned char)count;
+        op->value = degrees;
+        if (!reserveDirections(count + (ring ? 1 : 0), &op->table)) return false;
+        
+        if (ring && count <= DIRECTION_MAX_RING) {
+            memcpy(&directionPool[op->table], GetDirectionRing(count), count * sizeof(Vector2));
+        } else {
+            for (int i = 0; i < count; i++) {
+                float angle = ring ? i * (2.0f * PI / count) : (i - (count - 1) * 0.5f) * degrees * DEG2RAD;
+                directionPool[op->table + i] = (Vector2){ cosf(angle), sinf(angle) };
+            }
+        }
+        if (ring) {
+            directionPool[op->table + count] = (Vector2){ cosf(degrees * DEG2RAD), sinf(degrees * DEG2RAD) };
+        }
+        return true;
+    }
+    
+    if (strcmp(name, "dash") == 0) {
+        op->opcode = PATTERN_OP_DASH;
+        op->value = nextNumber(&ok);
+        op->value2 = nextNumber(&ok);
+        return ok && op->value < op->value2;
+    }
+    
+    if (strcmp(name, "teleport") == 0) {
+        op->opcode = PATTERN_OP_TELEPORT;
+        op->value = nextNumber(&ok);
+        return ok;
+    }
+    
+    if (strcmp(name, "health_below") == 0 || strcmp(name, "chance") == 0) {
+        op->opcode = (name[0] == 'h') ? PATTERN_OP_HEALTH_BELOW : PATTERN_OP_CHANCE;
+        op->value = nextNumber(&ok);
+        int skip = (int)nextNumber(&ok);
+        if (!ok || skip < 0 || skip >= BOSS_PATTERN_MAX_OPS) return false;
+        op->count = (unsigned char)skip;
+        return true;
+    }
+    
+    return false;
+}
+
+// Formato (uma diretiva por linha, '#' comenta):
+//   layer <1-4> <chase|jitter|wander> <fator de velocidade>
+//   program                              começa um programa da camada (até 2 rodam juntos)
+//   wait <s> | emit | ring <n> [giro°] | fan <n> <espaçamento°>
+//   dash <dist. mín> <dist. máx> | teleport <fração da distância>
+//   health_below <fração> <pular n> | chance <porcento> <pular n>
+// Cada programa repete do início ao chegar ao fim.
+static bool parsePatterns(AssetTextReader *reader) {
+    memset(layers, 0, sizeof(layers));
+    directionCount = 0;
+    
+    PatternLayer *layer = NULL;
+    PatternProgram *program = NULL;
+    
+    char *line;
+    while ((line = NextAssetLine(reader)) != NULL) {
+        char *directive = strtok(line, " \t\r");
+        
+        if (strcmp(directive, "layer") == 0) {
+            bool ok = true;
+            int number = (int)nextNumber(&ok);
+            char *mode = strtok(NULL, " \t\r");
+            float speedFactor = nextNumber(&ok);
+            if (!ok || mode == NULL || number < 1 || number > BOSS_PATTERN_LAYERS) return rejectPatternLine(reader);
+            
+            layer = &layers[number - 1];
+            program = NULL;
+            if (strcmp(mode, "chase") == 0) layer->movement.mode = BOSS_MOVE_CHASE;
+            else if (strcmp(mode, "jitter") == 0) layer->movement.mode = BOSS_MOVE_JITTER;
+            else if (strcmp(mode, "wander") == 0) layer->movement.mode = BOSS_MOVE_WANDER;
+            else return rejectPatternLine(reader);
+            layer->movement.speedFactor = speedFactor;
+        } else if (strcmp(directive, "program") == 0) {
+            if (layer == NULL || layer->programCount == BOSS_PATTERN_THREADS) return rejectPatternLine(reader);
+            program = &layer->programs[layer->programCount++];
+        } else {
+            if (program == NULL || program->opCount == BOSS_PATTERN_MAX_OPS) return rejectPatternLine(reader);
+            if (!compileOp(directive, &program->ops[program->opCount])) return rejectPatternLine(reader);
+            program->opCount++;
+        }
+    }
+    
+    // Toda camada precisa de programa, e um programa sem wait nem dash
+    // dispararia todo quadro: exigir um ponto de espera
+    for (int l = 0; l < BOSS_PATTERN_LAYERS; l++) {
+        if (layers[l].programCount == 0) {
+            printf("AVISO: %s sem a camada %d, usando os padrões embutidos\n", BOSS_PATTERN_FILE, l + 1);
+            return false;
+        }
+        for (int p = 0; p < layers[l].programCount; p++) {
+            const PatternProgram *checked = &layers[l].programs[p];
+            bool blocks = false;
+            for (int i = 0; i < checked->opCount; i++) {
+                if (checked->ops[i].opcode == PATTERN_OP_WAIT || checked->ops[i].opcode == PATTERN_OP_DASH) blocks = true;
+            }
+            if (!blocks) {
+                printf("AVISO: %s camada %d sem wait ou dash, usando os padrões embutidos\n", BOSS_PATTERN_FILE, l + 1);
+                return false;
+            }
+        }
+    }
+    
+    return true;
+}
+
+
+void LoadBossPatterns(void) {
+    AssetTextReader reader;
+    bool loaded = false;
+    if (OpenAssetText(&reader, BOSS_PATTERN_FILE)) {
+        loaded = parsePatterns(&reader);
+        CloseAssetText(&reader);
+    }
+    
+    if (!loaded) {
+        OpenAssetTextBuffer(&reader, BOSS_PATTERN_FILE, builtinPatterns, (int)strlen(builtinPatterns));
+        parsePatterns(&reader);
+    }
+}
+
+
+BossMovement GetBossMovement(int layer) {
+    if (layer < 1 || layer > BOSS_PATTERN_LAYERS) {
+        return (BossMovement){ BOSS_MOVE_CHASE, 0.5f };
+    }
+    return layers[layer - 1].movement;
+}
+
+
+void ResetBossPattern(BossPatternState *state, int layer) {
+    memset(state, 0, sizeof(BossPatternState));
+    state->layer = layer;
+    for (int i = 0; i < BOSS_PATTERN_THREADS; i++) {
+        state->threads[i].spin = (Vector2){ 1.0f, 0.0f };
+    }
+}
+
+
+static void runThread(BossPatternThread *thread, const PatternProgram *program,
+                      const BossPatternContext *context, float deltaTime, BulletList *enemyBullets) {
+    if (program->opCount == 0) return;
+    
+    if (thread->waitTimer > 0.0f) {
+        thread->waitTimer -= deltaTime;
+        if (thread->waitTimer > 0.0f) return;
+    }
+    
+    // No máximo uma volta pelo programa por quadro
+    for (int executed = 0; executed < program->opCount; executed++) {
+        // Durante uma investida só o programa que a começou continua
+        if (*context->isDashing && !thread->dashStarted) return;
+        
+        const PatternOp *op = &program->ops[thread->pc];
+        int next = thread->pc + 1;
+        
+        switch (op->opcode) {
+            case PATTERN_OP_WAIT:
+                thread->waitTimer += op->value;
+                thread->pc = (unsigned char)(next % program->opCount);
+                if (thread->waitTimer > 0.0f) return;
+                continue;
+            
+            case PATTERN_OP_EMIT:
+            case PATTERN_OP_FAN:
+                RotateDirections(&directionPool[op->table], op->count, context->aim, burst);
+                EmitBullets(enemyBullets, GetBulletArchetype(BULLET_KIND_STANDARD), BULLET_NO_MODIFIERS,
+                            *context->position, burst, op->count);
+                break;
+            
+            case PATTERN_OP_RING: {
+                RotateDirections(&directionPool[op->table], op->count, thread->spin, burst);
+                EmitBullets(enemyBullets, GetBulletArchetype(BULLET_KIND_STANDARD), BULLET_NO_MODIFIERS,
+                            *context->position, burst, op->count);
+                
+                // Avança o giro e corrige o comprimento (aproximação de 1/sqrt perto de 1)
+                Vector2 step = directionPool[op->table + op->count];
+                Vector2 spin = {
+                    thread->spin.x * step.x - thread->spin.y * step.y,
+                    thread->spin.x * step.y + thread->spin.y * step.x
+                };
+                float correction = 1.5f - 0.5f * (spin.x * spin.x + spin.y * spin.y);
+                thread->spin = (Vector2){ spin.x * correction, spin.y * correction };
+                break;
+            }
+            
+            case PATTERN_OP_DASH:
+                if (!thread->dashStarted) {
+                    bool inRange = context->distanceToPlayer > op->value && context->distanceToPlayer < op->value2;
+                    if (context->dashCooldown <= 0.0f && inRange) {
+                        *context->isDashing = true;
+                        *context->dashTimer = context->dashDuration;
+                        *context->dashDirection = context->aim;
+                        thread->dashStarted = true;
+                    }
+                    return;
+                }
+                if (*context->isDashing) return;
+                thread->dashStarted = false;
+                break;
+            
+            case PATTERN_OP_TELEPORT:
+                context->position->x += context->aim.x * context->distanceToPlayer * op->value;
+                context->position->y += context->aim.y * context->distanceToPlayer * op->value;
+                break;
+            
+            case PATTERN_OP_HEALTH_BELOW:
+                if (!(context->healthFraction < op->value)) next += op->count;
+                break;
+            
+            case PATTERN_OP_CHANCE:
+                if (!(GetRandomValue(0, 100) < op->value)) next += op->count;
+                break;
+        }
+        
+        thread->pc = (unsigned char)(next % program->opCount);
+    }
+}
+
+
+void RunBossPattern(BossPatternState *state, int layer, const BossPatternContext *context,
+                    float deltaTime, BulletList *enemyBullets) {
+    if (layer < 1 || layer > BOSS_PATTERN_LAYERS) return;
+    
+    if (state->layer != layer) {
+        ResetBossPattern(state, layer);
+    }
+    
+    const PatternLayer *patterns = &layers[layer - 1];
+    for (int i = 0; i < patterns->programCount; i++) {
+        runThread(&state->threads[i], &patterns->programs[i], context, deltaTime, enemyBullets);
+    }
+}
@@ -0,0 +1,65 @@
+#ifndef BOSS_PATTERN_H
+#define BOSS_PATTERN_H
+
+#include "raylib.h"
+#include "bullet.h"
+#include <stdbool.h>
+
+#define BOSS_PATTERN_FILE "assets/boss_patterns.txt"
+#define BOSS_PATTERN_LAYERS 4
+#define BOSS_PATTERN_THREADS 2           // programas rodando juntos em cada camada
+#define BOSS_PATTERN_MAX_OPS 32          // por programa
+#define BOSS_PATTERN_MAX_BURST 128       // balas por operação
+#define BOSS_PATTERN_DIRECTIONS 2048     // vetores pré-calculados de todas as camadas
+
+// Como o boss se move em cada camada
+typedef enum {
+    BOSS_MOVE_CHASE = 0,     // reto em direção ao jogador
+    BOSS_MOVE_JITTER,        // em direção ao jogador com desvio aleatório
+    BOSS_MOVE_WANDER         // para pontos sorteados em volta do jogador
+} BossMoveMode;
+
+typedef struct {
+    BossMoveMode mode;
+    float speedFactor;       // multiplica BOSS_BASE_SPEED
+} BossMovement;
+
+// Estado de execução de um programa
+typedef struct {
+    unsigned char pc;
+    bool dashStarted;        // a operação dash já disparou e espera o fim
+    float waitTimer;
+    Vector2 spin;            // rotação acumulada dos anéis giratórios (cos, sin)
+} BossPatternThread;
+
+typedef struct {
+    int layer;               // camada dos programas em execução (0 = nenhuma)
+    BossPatternThread threads[BOSS_PATTERN_THREADS];
+} BossPatternState;
+
+// O que o interpretador precisa do boss a cada quadro
+typedef struct {
+    Vector2 *position;
+    Vector2 aim;             // direção unitária até o jogador
+    float distanceToPlayer;
+    float healthFraction;    // vida da camada, de 0 a 1
+    bool *isDashing;
+    float *dashTimer;
+    float dashCooldown;
+    float dashDuration;
+    Vector2 *dashDirection;
+} BossPatternContext;
+
+// Lê os padrões do pacote de assets ou do arquivo solto; com erro usa os
+// padrões embutidos (os mesmos ataques de antes). Chamar depois do pacote ser aberto.
+void LoadBossPatterns(void);
+
+BossMovement GetBossMovement(int layer);
+
+void ResetBossPattern(BossPatternState *state, int layer);
+
+// Roda os programas da camada até cada um bloquear em wait ou dash
+void RunBossPattern(BossPatternState *state, int layer, const BossPatternContext *context,
+                    float deltaTime, BulletList *enemyBullets);
+
+#endif
@@ -1,99 +1,224 @@
 #include "bullet.h"
 #include <stdlib.h>
- #include <string.h> 
-#include <stdio.h> 
-#include "raymath.h" 
+#include <string.h>
+#include "raymath.h"
+#include "enemy.h"
+#include "direction_table.h"
 
-void AddBullet(Bullet **head, Vector2 startPosition, Vector2 direction, bool isPlayerBullet) {
-    Bullet *newBullet = (Bullet *)malloc(sizeof(Bullet));
-    if (!newBullet) return;
 
-    memset(newBullet, 0, sizeof(Bullet));
+static const BulletArchetype archetypes[BULLET_KIND_COUNT] = {
+    [BULLET_KIND_STANDARD]    = { .speed = BULLET_SPEED,        .radius = BULLET_RADIUS,        .damage = 1 },
+    [BULLET_KIND_RICOCHET]    = { .speed = BULLET_SPEED * 1.5f, .radius = BULLET_RADIUS * 1.2f, .damage = 1, .ricochets = 1 },
+    [BULLET_KIND_PENETRATING] = { .speed = BULLET_SPEED * 1.2f, .radius = BULLET_RADIUS * 1.1f, .damage = 2,
+                                  .pierce = BULLET_MAX_HITS - 1 },
+    [BULLET_KIND_HOMING]      = { .speed = BULLET_SPEED * 0.8f, .radius = BULLET_RADIUS,        .damage = 1, .homing = true }
+};
 
-    newBullet->position = startPosition;
+
+static bool reserveBullets(BulletList *list, int count) {
+    if (list->count + count <= list->capacity) return true;
     
-    if (Vector2LengthSqr(direction) > 0) {
-        newBullet->velocity = Vector2Scale(Vector2Normalize(direction), BULLET_SPEED);
-    } else {
-        newBullet->velocity = (Vector2){0, -BULLET_SPEED}; 
+    int capacity = (list->capacity == 0) ? 256 : list->capacity;
+    while (capacity < list->count + count) capacity *= 2;
+    
+    Bullet *items = realloc(list->items, capacity * sizeof(Bullet));
+    if (items == NULL) return false;
+    list->items = items;
+    list->capacity = capacity;
+    return true;
+}
+
+
+void InitBulletList(BulletList *list) {
+    list->items = NULL;
+    list->count = 0;
+    list->capacity = 0;
+}
+
+void ClearBullets(BulletList *list) {
+    list->count = 0;
+}
+
+void FreeBullets(BulletList *list) {
+    free(list->items);
+    InitBulletList(list);
+}
+
+
+const BulletArchetype *GetBulletArchetype(BulletKind kind) {
+    if (kind < 0 || kind >= BULLET_KIND_COUNT) kind = BULLET_KIND_STANDARD;
+    return &archetypes[kind];
+}
+
+
+void EmitBullets(BulletList *list, const BulletArchetype *archetype, BulletModifiers modifiers,
+                 Vector2 origin, const Vector2 *directions, int count) {
+    if (count <= 0 || !reserveBullets(list, count)) return;
+    
+    // Tudo que não depende da direção é montado uma vez e copiado
+    Bullet prototype;
+    memset(&prototype, 0, sizeof(Bullet));
+    prototype.position = origin;
+    prototype.radius = archetype->radius * modifiers.radiusScale;
+    prototype.damage = archetype->damage * modifiers.damageMultiplier;
+    prototype.active = true;
+    prototype.canRicochet = archetype->ricochets > 0;
+    prototype.ricochetsLeft = archetype->ricochets;
+    prototype.homing = archetype->homing;
+    prototype.pierceLeft = archetype->pierce;
+    
+    Bullet *out = &list->items[list->count];
+    for (int i = 0; i < count; i++) {
+        Vector2 direction = directions[i];
+        if (direction.x == 0.0f && direction.y == 0.0f) direction = (Vector2){ 0.0f, -1.0f };
+        
+        out[i] = prototype;
+        out[i].velocity = (Vector2){ direction.x * archetype->speed, direction.y * archetype->speed };
     }
+    list->count += count;
+}
+
+
+// Gira a velocidade rumo ao inimigo mais perto, no máximo HOMING_TURN_RATE por segundo
+static void steerHomingBullet(Bullet *bullet, float deltaTime) {
+    Vector2 target;
+    if (!FindNearestEnemy(bullet->position, HOMING_RANGE, &target)) return;
     
-    // Verificar se o jogador tem dano aumentado - APENAS para tiros do jogador
-    extern bool increasedDamage; 
+    float speed = Vector2Length(bullet->velocity);
+    Vector2 toTarget = Vector2Subtract(target, bullet->position);
+    float distanceSqr = Vector2LengthSqr(toTarget);
+    if (speed <= 0.0f || distanceSqr <= 0.0f) return;
     
-    if (isPlayerBullet && increasedDamage) {
-        newBullet->radius = BULLET_RADIUS * 1.5f; // Projéteis maiores
-        newBullet->damage = 2; // Dano dobrado
+    Vector2 heading = Vector2Scale(bullet->velocity, 1.0f / speed);
+    Vector2 desired = Vector2Scale(toTarget, 1.0f / sqrtf(distanceSqr));
+    Vector2 turn = DirectionFromAngle(AngleFromRadians(HOMING_TURN_RATE * deltaTime));
+    
+    // Dentro do giro do quadro aponta direto; senão gira o máximo para o lado do alvo
+    if (Vector2DotProduct(heading, desired) >= turn.x) {
+        heading = desired;
     } else {
-        newBullet->radius = BULLET_RADIUS;
-        newBullet->damage = 1;
+        if (heading.x * desired.y - heading.y * desired.x < 0.0f) turn.y = -turn.y;
+        heading = RotateDirection(heading, turn);
     }
-    
-    newBullet->active = true;  
-    newBullet->next = *head;
-    *head = newBullet;
+    bullet->velocity = Vector2Scale(heading, speed);
 }
 
-void UpdateBullets(Bullet **bullets, float deltaTime, int screenWidth, int screenHeight) {
-    Bullet *currentBullet = *bullets;
-    Bullet *prevBullet = NULL;
+// Borda da arena ao longo do quadro: raio(t) = radiusStart + radiusRate * t
+typedef struct {
+    Vector2 center;
+    float radiusStart;
+    float radiusRate;
+} ArenaBoundary;
+
+// Move a bala pelo quadro quicando na borda que se move. O caso comum é só um
+// teste de distância ao quadrado no fim do passo; a raiz só é tirada quando há
+// impacto, no instante exato em que a bala encontra a borda.
+static void moveRicochetBullet(Bullet *bullet, const ArenaBoundary *arena, float deltaTime) {
+    float px = bullet->position.x - arena->center.x;
+    float py = bullet->position.y - arena->center.y;
+    float rate = arena->radiusRate;
+    float elapsed = 0.0f;
     
-    while (currentBullet != NULL) {
-        // VERIFICAÇÃO DE SEGURANÇA PARA MEMÓRIA CORROMPIDA
-        if ((uintptr_t)currentBullet < 1024) {
-            printf("ERRO: Ponteiro de bullet corrompido: %p\n", (void*)currentBullet);
-            break;
-        }
+    for (int bounce = 0; bounce < BULLET_MAX_BOUNCES_PER_TICK && bullet->ricochetsLeft > 0; bounce++) {
+        float remaining = deltaTime - elapsed;
+        float vx = bullet->velocity.x;
+        float vy = bullet->velocity.y;
+        float wall = arena->radiusStart + rate * elapsed - bullet->radius;
+        float wallEnd = wall + rate * remaining;
+        
+        // f(t) = |p + v t|² - (wall + rate t)² é convexa quando a bala é mais
+        // rápida que a borda: negativa nas duas pontas, negativa no passo todo
+        float a = vx * vx + vy * vy - rate * rate;
+        if (a <= 0.0f || wallEnd <= 0.0f) break;
+        float endX = px + vx * remaining;
+        float endY = py + vy * remaining;
+        if (endX * endX + endY * endY < wallEnd * wallEnd) break;
         
-        // VERIFICAR SE TODOS OS CAMPOS BOOL TÊM VALORES VÁLIDOS
-        if (currentBullet->active != 0 && currentBullet->active != 1) {
-            printf("ERRO: Campo active corrompido: %d\n", currentBullet->active);
-            currentBullet->active = false;
+        float halfB = px * vx + py * vy - wall * rate;
+        float c = px * px + py * py - wall * wall;
+        float discriminant = halfB * halfB - a * c;
+        float t = 0.0f;
+        bool outside = false;
+        if (c < 0.0f) {
+            // Dentro: raiz positiva de a t² + 2 halfB t + c = 0 (forma sem cancelamento)
+            float root = sqrtf(discriminant);
+            t = (halfB >= 0.0f) ? -c / (halfB + root) : (root - halfB) / a;
+        } else if (halfB > 0.0f) {
+            outside = true; // Na borda ou fora dela e se afastando: quica já
+        } else {
+            // Na borda voltando para dentro (logo depois de um quique): próxima saída
+            if (discriminant < 0.0f) break;
+            t = (sqrtf(discriminant) - halfB) / a;
         }
         
-        if (currentBullet->canRicochet != 0 && currentBullet->canRicochet != 1) {
-            printf("ERRO: Campo canRicochet corrompido: %d\n", currentBullet->canRicochet);
-            currentBullet->canRicochet = false;
+        px += vx * t;
+        py += vy * t;
+        elapsed += t;
+        float wallNow = wall + rate * t;
+        
+        // No impacto |p| == wallNow e a normal sai sem normalizar; só quem já
+        // estava fora (a borda passou por cima dela) precisa do comprimento
+        float nx, ny;
+        if (!outside) {
+            nx = px / wallNow;
+            ny = py / wallNow;
+        } else {
+            float length = sqrtf(px * px + py * py);
+            if (length <= 0.0f) break;
+            nx = px / length;
+            ny = py / length;
+            px = nx * wallNow;
+            py = ny * wallNow;
         }
         
+        // Reflexão no referencial da borda: a velocidade radial relativa troca de sinal
+        float approach = vx * nx + vy * ny - rate;
+        bullet->velocity.x = vx - 2.0f * approach * nx;
+        bullet->velocity.y = vy - 2.0f * approach * ny;
+        bullet->ricochetsLeft--;
+    }
+    
+    float remaining = deltaTime - elapsed;
+    bullet->position.x = arena->center.x + px + bullet->velocity.x * remaining;
+    bullet->position.y = arena->center.y + py + bullet->velocity.y * remaining;
+}
+
+void UpdateBullets(BulletList *list, float deltaTime, int screenWidth, int screenHeight) {
+    extern float currentPlayAreaRadius;
+    ArenaBoundary arena = {
+        .center = { PLAY_AREA_CENTER_X, PLAY_AREA_CENTER_Y },
+        .radiusStart = currentPlayAreaRadius - GetPlayAreaRadiusRate() * deltaTime,
+        .radiusRate = GetPlayAreaRadiusRate()
+    };
+    
+    // Compacta no lugar: as vivas são copiadas para frente, na mesma ordem
+    int alive = 0;
+    for (int i = 0; i < list->count; i++) {
+        Bullet *currentBullet = &list->items[i];
+        
         if (currentBullet->active) {
             
-            currentBullet->position.x += currentBullet->velocity.x * deltaTime;
-            currentBullet->position.y += currentBullet->velocity.y * deltaTime;
-
+            if (currentBullet->homing) {
+                steerHomingBullet(currentBullet, deltaTime);
+            }
             
+            // Quicantes seguem o mesmo passo reto; só quem termina fora da borda vai ao solver
+            float nextX = currentBullet->position.x + currentBullet->velocity.x * deltaTime;
+            float nextY = currentBullet->position.y + currentBullet->velocity.y * deltaTime;
+            bool bounces = false;
             if (currentBullet->canRicochet && currentBullet->ricochetsLeft > 0) {
-                
-                extern float currentPlayAreaRadius;
-                Vector2 center = {PLAY_AREA_CENTER_X, PLAY_AREA_CENTER_Y};
-                float distToCenter = Vector2Distance(currentBullet->position, center);
-                
-                if (distToCenter >= currentPlayAreaRadius - currentBullet->radius) {
-                    
-                    Vector2 normal = Vector2Normalize(Vector2Subtract(center, currentBullet->position));
-                    
-                    
-                    float dotProduct = Vector2DotProduct(currentBullet->velocity, normal);
-                    Vector2 reflection = Vector2Subtract(
-                        currentBullet->velocity,
-                        Vector2Scale(normal, 2 * dotProduct)
-                    );
-                    
-                    
-                    currentBullet->velocity = reflection;
-                    currentBullet->ricochetsLeft--;
-                    
-                    
-                    currentBullet->position = Vector2Add(
-                        center,
-                        Vector2Scale(
-                            Vector2Normalize(Vector2Subtract(currentBullet->position, center)),
-                            currentPlayAreaRadius - currentBullet->radius - 2.0f
-                        )
-                    );
-                }
+                float dx = nextX - arena.center.x;
+                float dy = nextY - arena.center.y;
+                float wallEnd = currentPlayAreaRadius - currentBullet->radius;
+                bounces = dx * dx + dy * dy >= wallEnd * wallEnd;
             }
             
+            if (bounces) {
+                moveRicochetBullet(currentBullet, &arena, deltaTime);
+            } else {
+                currentBullet->position.x = nextX;
+                currentBullet->position.y = nextY;
+            }
             
             if (currentBullet->position.x + currentBullet->radius < 0 ||
                 currentBullet->position.x - currentBullet->radius > screenWidth ||
@@ -102,126 +227,27 @@ void UpdateBullets(Bullet **bullets, float deltaTime, int screenWidth, int scree
                 currentBullet->active = false;
             }
         }
-
         
-        if (!currentBullet->active) {
-            Bullet *toRemove = currentBullet;
-            
-            if (prevBullet == NULL) { 
-                *bullets = currentBullet->next;
-                currentBullet = *bullets;
-            } else {
-                prevBullet->next = currentBullet->next;
-                currentBullet = currentBullet->next;
-            }
-            
-            free(toRemove);
-        } else {
-            prevBullet = currentBullet;
-            currentBullet = currentBullet->next;
+        if (currentBullet->active) {
+            if (alive != i) list->items[alive] = *currentBullet;
+            alive++;
         }
     }
-}
-
-void FreeBullets(Bullet **head) {
-    Bullet *current = *head;
-    while (current != NULL) {
-        Bullet *next = current->next;
-        free(current);
-        current = next;
-    }
-    *head = NULL;
+    list->count = alive;
 }
 
 
-void AddBulletWithProps(Bullet **bulletsList, Vector2 position, Vector2 direction, float radius, int damage) {
-    Bullet *bullet = (Bullet*)malloc(sizeof(Bullet));
-    if (bullet) {
-        // INICIALIZAR TODA A ESTRUTURA PRIMEIRO
-        memset(bullet, 0, sizeof(Bullet));
-        
-        bullet->position = position;
-        bullet->velocity = Vector2Scale(direction, BULLET_SPEED);
-        bullet->active = true;
-        bullet->radius = radius;
-        bullet->damage = damage;
-        
-        // GARANTIR QUE CAMPOS BOOL ESTÃO CORRETOS
-        bullet->canRicochet = false;    // Inicializar explicitamente
-        bullet->ricochetsLeft = 0;      // Inicializar explicitamente
-        
-        bullet->next = *bulletsList;
-        *bulletsList = bullet;
+bool BulletHasHit(const Bullet *bullet, unsigned int targetId) {
+    for (int i = 0; i < bullet->hitCount; i++) {
+        if (bullet->hits[i] == targetId) return true;
     }
+    return false;
 }
 
-
-void AddRicochetBullet(Bullet **head, Vector2 startPosition, Vector2 direction) {
-    Bullet *newBullet = (Bullet *)malloc(sizeof(Bullet));
-    if (!newBullet) return;
-
-    memset(newBullet, 0, sizeof(Bullet));
-
-    newBullet->position = startPosition;
+bool RegisterBulletHit(Bullet *bullet, unsigned int targetId) {
+    if (bullet->pierceLeft <= 0 || bullet->hitCount == BULLET_MAX_HITS) return false;
     
-    if (Vector2LengthSqr(direction) > 0) {
-        newBullet->velocity = Vector2Scale(Vector2Normalize(direction), BULLET_SPEED * 1.5f); 
-    } else {
-        newBullet->velocity = (Vector2){0, -BULLET_SPEED * 1.5f};
-    }
-    newBullet->radius = BULLET_RADIUS * 1.2f; 
-    newBullet->active = true;
-    newBullet->damage = 1;
-    newBullet->canRicochet = true;  
-    newBullet->ricochetsLeft = 1;   
-    newBullet->next = *head;
-    *head = newBullet;
-}
-
-// Bala penetrante que atravessa inimigos
-void AddPenetratingBullet(Bullet **head, Vector2 startPosition, Vector2 direction) {
-    Bullet *newBullet = (Bullet *)malloc(sizeof(Bullet));
-    if (!newBullet) return;
-
-    memset(newBullet, 0, sizeof(Bullet));
-
-    newBullet->position = startPosition;
-    
-    if (Vector2LengthSqr(direction) > 0) {
-        newBullet->velocity = Vector2Scale(Vector2Normalize(direction), BULLET_SPEED * 1.2f);
-    } else {
-        newBullet->velocity = (Vector2){0, -BULLET_SPEED * 1.2f};
-    }
-    
-    newBullet->radius = BULLET_RADIUS * 1.1f;
-    newBullet->active = true;
-    newBullet->damage = 2;  // Dano aumentado
-    // Propriedade especial: Esta bala não é desativada ao atingir inimigos (implementada na lógica de colisão)
-    
-    newBullet->next = *head;
-    *head = newBullet;
+    bullet->hits[bullet->hitCount++] = targetId;
+    bullet->pierceLeft--;
+    return true;
 }
-
-// Bala teleguiada que persegue o inimigo mais próximo
-void AddHomingBullet(Bullet **head, Vector2 startPosition, Vector2 direction) {
-    Bullet *newBullet = (Bullet *)malloc(sizeof(Bullet));
-    if (!newBullet) return;
-
-    memset(newBullet, 0, sizeof(Bullet));
-
-    newBullet->position = startPosition;
-    
-    if (Vector2LengthSqr(direction) > 0) {
-        newBullet->velocity = Vector2Scale(Vector2Normalize(direction), BULLET_SPEED * 0.8f);
-    } else {
-        newBullet->velocity = (Vector2){0, -BULLET_SPEED * 0.8f};
-    }
-    
-    newBullet->radius = BULLET_RADIUS;
-    newBullet->active = true;
-    newBullet->damage = 1;
-    // Propriedade especial: Esta bala deve seguir inimigos (implementada na função UpdateBullets)
-    
-    newBullet->next = *head;
-    *head = newBullet;
-}
\ No newline at end of file
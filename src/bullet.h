@@ -2,7 +2,13 @@
 #define BULLET_H
 
 #include "raylib.h"
-#include "utils.h" 
+#include "utils.h"
+
+#define HOMING_RANGE 350.0f          // alcance da busca por alvo das teleguiadas
+#define HOMING_TURN_RATE 5.0f        // giro máximo em rad/s
+#define BULLET_MAX_HITS 8            // inimigos que uma penetrante atravessa
+#define BULLET_TARGET_BOSS 0u        // id do boss no conjunto de acertos (inimigos começam em 1)
+#define BULLET_MAX_BOUNCES_PER_TICK 4 // quiques resolvidos num mesmo quadro
 
 typedef struct Bullet {
     Vector2 position;
@@ -10,19 +16,67 @@ typedef struct Bullet {
     float radius;
     bool active;
     int damage;
-    bool canRicochet;    
-    int ricochetsLeft;   
-    struct Bullet *next;
+    bool canRicochet;
+    int ricochetsLeft;
+    bool homing;         // curva em direção ao inimigo mais perto
+    int pierceLeft;      // alvos que ainda atravessa; hits evita acertar o mesmo duas vezes
+    int hitCount;
+    unsigned int hits[BULLET_MAX_HITS];
 } Bullet;
 
-void AddBullet(Bullet **head, Vector2 startPosition, Vector2 direction, bool isPlayerBullet);
-void AddBulletWithProps(Bullet **head, Vector2 startPosition, Vector2 direction, float radius, int damage);
-void AddRicochetBullet(Bullet **head, Vector2 startPosition, Vector2 direction); 
-void UpdateBullets(Bullet **head, float deltaTime, int screenWidth, int screenHeight);
-void DestroyBullets(Bullet **head);
+// Balas vivas guardadas lado a lado em [0, count); UpdateBullets compacta
+// o vetor, então ponteiros para balas só valem até a próxima atualização
+// ou emissão na mesma lista
+typedef struct {
+    Bullet *items;
+    int count;
+    int capacity;
+} BulletList;
+
+// O que define um tipo de bala; as emissões partem sempre de um arquétipo
+typedef struct {
+    float speed;
+    float radius;
+    int damage;
+    int ricochets;           // quiques na borda da arena
+    bool homing;
+    int pierce;              // inimigos atravessados antes de sumir (até BULLET_MAX_HITS - 1)
+} BulletArchetype;
+
+typedef enum {
+    BULLET_KIND_STANDARD = 0,    // tiro comum, do jogador ou de inimigos
+    BULLET_KIND_RICOCHET,        // mais rápida e maior, quica uma vez
+    BULLET_KIND_PENETRATING,     // atravessa inimigos, dano 2
+    BULLET_KIND_HOMING,          // mais lenta, persegue o inimigo mais perto
+    BULLET_KIND_COUNT
+} BulletKind;
+
+// Modificadores de quem atira (power-ups), aplicados sobre o arquétipo
+typedef struct {
+    int damageMultiplier;
+    float radiusScale;
+} BulletModifiers;
+
+#define BULLET_NO_MODIFIERS ((BulletModifiers){ 1, 1.0f })
+
+void InitBulletList(BulletList *list);
+// Esvazia mantendo a memória para a próxima partida
+void ClearBullets(BulletList *list);
+void FreeBullets(BulletList *list);
+
+const BulletArchetype *GetBulletArchetype(BulletKind kind);
+
+// Emite count balas do arquétipo saindo de origin, uma por direção unitária
+// (direção nula sai para cima). Reserva espaço e inicializa tudo numa passada.
+void EmitBullets(BulletList *list, const BulletArchetype *archetype, BulletModifiers modifiers,
+                 Vector2 origin, const Vector2 *directions, int count);
+
+void UpdateBullets(BulletList *list, float deltaTime, int screenWidth, int screenHeight);
 
-// Adicione estas declarações junto com as outras funções de balas
-void AddPenetratingBullet(Bullet **head, Vector2 startPosition, Vector2 direction);
-void AddHomingBullet(Bullet **head, Vector2 startPosition, Vector2 direction);
+// Conjunto de acertos das penetrantes (ids de inimigo ou BULLET_TARGET_BOSS)
+bool BulletHasHit(const Bullet *bullet, unsigned int targetId);
+// Anota o acerto; devolve false quando a bala deve sumir (sem pierce ou
+// depois de atravessar todos os alvos que podia)
+bool RegisterBulletHit(Bullet *bullet, unsigned int targetId);
 
-#endif
\ No newline at end of file
+#endif
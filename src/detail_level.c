@@ -0,0 +1,64 @@
+#include "detail_level.h"
+#include "utils.h"
+
+
+#define FRAME_TIME_SMOOTHING 0.1f   // peso do frame novo na média móvel
+#define RAISE_DELAY 0.5f            // segundos acima do orçamento para reduzir o detalhe
+#define LOWER_DELAY 2.0f            // segundos folgados para voltar a aumentar
+#define ENTITY_HYSTERESIS 10        // folga na contagem para não alternar no limite
+
+
+static float averageFrameTime = 1.0f / TARGET_FPS;
+static float overBudgetTime = 0.0f;
+static float underBudgetTime = 0.0f;
+static DetailLevel loadLevel = DETAIL_FULL;
+static DetailLevel countLevel = DETAIL_FULL;
+
+
+static DetailLevel levelForCount(int entityCount) {
+    // Só cai de nível quando a contagem fica bem abaixo do limite
+    int margin = ENTITY_HYSTERESIS;
+    
+    if (entityCount >= DETAIL_MINIMAL_ENTITIES ||
+        (countLevel == DETAIL_MINIMAL && entityCount >= DETAIL_MINIMAL_ENTITIES - margin)) {
+        return DETAIL_MINIMAL;
+    }
+    if (entityCount >= DETAIL_REDUCED_ENTITIES ||
+        (countLevel >= DETAIL_REDUCED && entityCount >= DETAIL_REDUCED_ENTITIES - margin)) {
+        return DETAIL_REDUCED;
+    }
+    return DETAIL_FULL;
+}
+
+
+void UpdateDetailLevel(float frameTime, int entityCount) {
+    // Frames muito longos (janela arrastada, carregamento) não contam
+    if (frameTime > 0.0f && frameTime < 0.25f) {
+        averageFrameTime += (frameTime - averageFrameTime) * FRAME_TIME_SMOOTHING;
+    }
+    
+    float budget = 1.0f / TARGET_FPS;
+    
+    if (averageFrameTime > budget * DETAIL_BUDGET_MARGIN) {
+        overBudgetTime += frameTime;
+        underBudgetTime = 0.0f;
+        if (overBudgetTime >= RAISE_DELAY && loadLevel < DETAIL_MINIMAL) {
+            loadLevel++;
+            overBudgetTime = 0.0f;
+        }
+    } else if (averageFrameTime < budget * 1.05f) {
+        underBudgetTime += frameTime;
+        overBudgetTime = 0.0f;
+        if (underBudgetTime >= LOWER_DELAY && loadLevel > DETAIL_FULL) {
+            loadLevel--;
+            underBudgetTime = 0.0f;
+        }
+    }
+    
+    countLevel = levelForCount(entityCount);
+}
+
+
+DetailLevel GetDetailLevel(void) {
+    return loadLevel > countLevel ? loadLevel : countLevel;
+}
@@ -0,0 +1,21 @@
+#ifndef DETAIL_LEVEL_H
+#define DETAIL_LEVEL_H
+
+// Nível de detalhe das decorações das entidades (camadas, pulsos, partículas)
+typedef enum {
+    DETAIL_FULL = 0,
+    DETAIL_REDUCED,    // menos camadas e partículas, pulso único por frame
+    DETAIL_MINIMAL     // só a silhueta de cada entidade, sem pulso
+} DetailLevel;
+
+#define DETAIL_REDUCED_ENTITIES 60    // inimigos + balas a partir dos quais reduzir
+#define DETAIL_MINIMAL_ENTITIES 150
+#define DETAIL_BUDGET_MARGIN 1.2f     // acima de 120% do orçamento do frame conta como sobrecarga
+
+// Chamado uma vez por frame de jogo com o tempo do frame anterior e o total de
+// entidades em cena. O nível sobe rápido sob carga e só desce depois de um
+// tempo folgado, para não ficar oscilando.
+void UpdateDetailLevel(float frameTime, int entityCount);
+DetailLevel GetDetailLevel(void);
+
+#endif
@@ -0,0 +1,66 @@
+#include "direction_table.h"
+#include <math.h>
+
+
+static Vector2 unitTable[DIRECTION_TABLE_SIZE];
+
+// Anel de n pontos começa em ringStart[n]; 1 + 2 + ... + 32 = 528 vetores
+static Vector2 rings[DIRECTION_MAX_RING * (DIRECTION_MAX_RING + 1) / 2];
+static int ringStart[DIRECTION_MAX_RING + 1];
+
+
+void InitDirectionTables(void) {
+    for (int i = 0; i < DIRECTION_TABLE_SIZE; i++) {
+        float angle = i * (2.0f * PI / DIRECTION_TABLE_SIZE);
+        unitTable[i] = (Vector2){ cosf(angle), sinf(angle) };
+    }
+    
+    // Anéis calculados exatos (não pela tabela) para não herdar a quantização
+    int next = 0;
+    for (int count = 1; count <= DIRECTION_MAX_RING; count++) {
+        ringStart[count] = next;
+        for (int i = 0; i < count; i++) {
+            float angle = i * (2.0f * PI / count);
+            rings[next++] = (Vector2){ cosf(angle), sinf(angle) };
+        }
+    }
+}
+
+
+const Vector2 *GetDirectionRing(int count) {
+    if (count < 1) count = 1;
+    if (count > DIRECTION_MAX_RING) count = DIRECTION_MAX_RING;
+    return &rings[ringStart[count]];
+}
+
+
+Vector2 DirectionFromAngle(FixedAngle angle) {
+    // Arredonda para a entrada mais próxima; o & fecha a volta em 4096
+    int index = ((angle + (1 << (15 - DIRECTION_TABLE_BITS))) >> (16 - DIRECTION_TABLE_BITS)) & (DIRECTION_TABLE_SIZE - 1);
+    return unitTable[index];
+}
+
+
+FixedAngle AngleFromRadians(float radians) {
+    // Mascara em vez de converter direto: ângulos negativos dão a volta
+    return (FixedAngle)(lrintf(radians * (FIXED_ANGLE_TURN / (2.0f * PI))) & 0xFFFF);
+}
+
+FixedAngle AngleFromDegrees(float degrees) {
+    return (FixedAngle)(lrintf(degrees * (FIXED_ANGLE_TURN / 360.0f)) & 0xFFFF);
+}
+
+
+Vector2 RotateDirection(Vector2 vector, Vector2 rotation) {
+    return (Vector2){
+        vector.x * rotation.x - vector.y * rotation.y,
+        vector.x * rotation.y + vector.y * rotation.x
+    };
+}
+
+void RotateDirections(const Vector2 *directions, int count, Vector2 rotation, Vector2 *out) {
+    for (int i = 0; i < count; i++) {
+        out[i].x = directions[i].x * rotation.x - directions[i].y * rotation.y;
+        out[i].y = directions[i].x * rotation.y + directions[i].y * rotation.x;
+    }
+}
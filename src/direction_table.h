@@ -0,0 +1,34 @@
+#ifndef DIRECTION_TABLE_H
+#define DIRECTION_TABLE_H
+
+#include "raylib.h"
+
+// Ângulo em ponto fixo: uma volta completa = 65536, então somar e subtrair
+// dá a volta sozinho no estouro de 16 bits
+typedef unsigned short FixedAngle;
+
+#define FIXED_ANGLE_TURN 65536
+#define DIRECTION_TABLE_BITS 12                          // 4096 direções por volta
+#define DIRECTION_TABLE_SIZE (1 << DIRECTION_TABLE_BITS)
+#define DIRECTION_MAX_RING 32                            // anéis pré-calculados: 1 a 32 pontos
+
+// Calcula as tabelas (única vez em que cos/sin são chamados); chamar em InitGame
+void InitDirectionTables(void);
+
+// count vetores unitários igualmente espaçados, começando em (1, 0).
+// count vai de 1 a DIRECTION_MAX_RING.
+const Vector2 *GetDirectionRing(int count);
+
+// Vetor unitário do ângulo (precisão de 1/4096 de volta)
+Vector2 DirectionFromAngle(FixedAngle angle);
+
+FixedAngle AngleFromRadians(float radians);
+FixedAngle AngleFromDegrees(float degrees);
+
+// Gira vector pelo vetor unitário rotation (multiplicação complexa)
+Vector2 RotateDirection(Vector2 vector, Vector2 rotation);
+
+// Gira count vetores de uma vez; é o caminho dos emissores de anel e leque
+void RotateDirections(const Vector2 *directions, int count, Vector2 rotation, Vector2 *out);
+
+#endif
@@ -3,6 +3,71 @@
 #include "raymath.h" 
 #include <math.h>    
 #include <stdio.h>
+#include "flow_field.h"
+#include "spatial_grid.h"
+#include "direction_table.h"
+
+// Posições do início do tick, para a separação e a mira das teleguiadas
+static SpatialGrid enemyGrid = { 0 };
+static bool separationEnabled = true;
+static unsigned int nextEnemyId = 1;
+
+// Lote denso de um comportamento em estrutura de vetores: cada kernel percorre
+// vetores contíguos sem trocar de tipo no meio do laço. O tamanho é arredondado
+// para um múltiplo de ENEMY_BATCH_LANES (sobras zeradas), assim o compilador
+// vetoriza os laços sem precisar de um resto escalar.
+#define ENEMY_BATCH_LANES 4
+
+typedef struct {
+    Enemy **enemies;
+    float *x;
+    float *y;
+    float *dirX;             // direção e depois velocidade final
+    float *dirY;
+    float *speed;
+    float *timer;            // tempo desde o último tiro (só atiradores)
+    float *fired;            // 1 quando o atirador dispara neste tick
+    int count;
+    int capacity;
+} EnemyBatch;
+
+// Disparo anotado durante o kernel dos atiradores
+typedef struct {
+    Vector2 origin;
+    Vector2 aim;             // direção unitária até o jogador
+} ShotRequest;
+
+static EnemyBatch chasers = { 0 };
+static EnemyBatch shooters = { 0 };
+static ShotRequest *shotRequests = NULL;
+static int shotCapacity = 0;
+
+static bool reserveShotRequests(int count) {
+    if (count <= shotCapacity) return true;
+    
+    ShotRequest *requests = realloc(shotRequests, count * sizeof(ShotRequest));
+    if (requests == NULL) return false;
+    shotRequests = requests;
+    shotCapacity = count;
+    return true;
+}
+
+void SetEnemySeparation(bool enabled) {
+    separationEnabled = enabled;
+}
+
+bool IsEnemySeparationEnabled(void) {
+    return separationEnabled;
+}
+
+bool FindNearestEnemy(Vector2 position, float range, Vector2 *target) {
+    const GridEntry *nearest = FindNearestInSpatialGrid(&enemyGrid, position, range);
+    if (nearest == NULL) return false;
+    
+    // A entrada guarda a posição do início do quadro; o inimigo já andou
+    *target = ((const Enemy *)nearest->item)->position;
+    return true;
+}
 
 void InitEnemyList(EnemyList *list) {
     list->head = NULL;
@@ -20,6 +85,8 @@ void AddEnemy(EnemyList *list, Vector2 position, float radius, float speed, Colo
     newEnemy->type = type;
     newEnemy->isDying = false;    
     newEnemy->deathTimer = 0.0f;  
+    newEnemy->id = nextEnemyId++;
+    if (nextEnemyId == 0) nextEnemyId = 1; // 0 fica para o boss
     
     
     switch (type) {
@@ -63,80 +130,234 @@ void AddEnemy(EnemyList *list, Vector2 position, float radius, float speed, Colo
 }
 
 
-void UpdateNormalEnemy(Enemy *enemy, Vector2 playerPosition, float deltaTime) {
-    Vector2 directionToPlayer = Vector2Subtract(playerPosition, enemy->position);
-    if (Vector2LengthSqr(directionToPlayer) > 0) {
-        enemy->velocity = Vector2Scale(Vector2Normalize(directionToPlayer), enemy->speed);
-    } else {
-        enemy->velocity = (Vector2){0,0};
+// Afastamento proporcional à sobreposição com os vizinhos da grade
+static Vector2 separationFrom(const Enemy *enemy) {
+    const GridEntry *neighbors[ENEMY_SEPARATION_NEIGHBORS];
+    int found = QuerySpatialGrid(&enemyGrid, enemy->position, enemy->radius + ENEMY_SEPARATION_MARGIN,
+                                 neighbors, ENEMY_SEPARATION_NEIGHBORS);
+    
+    Vector2 push = { 0.0f, 0.0f };
+    for (int i = 0; i < found; i++) {
+        if (neighbors[i]->item == enemy) continue;
+        
+        Vector2 away = Vector2Subtract(enemy->position, neighbors[i]->position);
+        float distance = Vector2Length(away);
+        float reach = enemy->radius + neighbors[i]->radius + ENEMY_SEPARATION_MARGIN;
+        if (distance >= reach) continue;
+        
+        // Dois inimigos no mesmo ponto: desempatar pelo endereço
+        if (distance <= 0.0f) {
+            away = ((uintptr_t)enemy < (uintptr_t)neighbors[i]->item) ? (Vector2){ 1.0f, 0.0f } : (Vector2){ -1.0f, 0.0f };
+            distance = 1.0f;
+        }
+        
+        push = Vector2Add(push, Vector2Scale(away, (reach - distance) / (reach * distance)));
     }
-
-    enemy->position.x += enemy->velocity.x * deltaTime;
-    enemy->position.y += enemy->velocity.y * deltaTime;
+    return push;
 }
 
+static int paddedCount(int count) {
+    return (count + ENEMY_BATCH_LANES - 1) & ~(ENEMY_BATCH_LANES - 1);
+}
 
-void UpdateShooterEnemy(Enemy *enemy, Vector2 playerPosition, float deltaTime, Bullet **enemyBullets) {
-    Vector2 directionToPlayer = Vector2Subtract(playerPosition, enemy->position);
-    float distanceToPlayer = Vector2Length(directionToPlayer);
+// Garante espaço para count inimigos no lote (os vetores só crescem)
+static bool reserveBatch(EnemyBatch *batch, int count) {
+    count = paddedCount(count);
+    if (count <= batch->capacity) return true;
     
+    int capacity = (batch->capacity == 0) ? 64 : batch->capacity;
+    while (capacity < count) capacity *= 2;
     
-    enemy->shootTimer += deltaTime;
+    Enemy **enemies = realloc(batch->enemies, capacity * sizeof(Enemy *));
+    if (enemies == NULL) return false;
+    batch->enemies = enemies;
     
+    float **lanes[] = { &batch->x, &batch->y, &batch->dirX, &batch->dirY, &batch->speed, &batch->timer, &batch->fired };
+    for (int i = 0; i < (int)(sizeof(lanes) / sizeof(lanes[0])); i++) {
+        float *lane = realloc(*lanes[i], capacity * sizeof(float));
+        if (lane == NULL) return false;
+        *lanes[i] = lane;
+    }
     
-    if (distanceToPlayer < 200.0f) {
-        
-        enemy->velocity = Vector2Scale(Vector2Normalize(directionToPlayer), -enemy->speed * 1.2f);
-    } else if (distanceToPlayer > 450.0f) {
-        
-        enemy->velocity = Vector2Scale(Vector2Normalize(directionToPlayer), enemy->speed * 0.8f);
-    } else {
-        
-        
-        
-        Vector2 sideDirection = {-directionToPlayer.y, directionToPlayer.x};
-        sideDirection = Vector2Normalize(sideDirection);
-        
-        
-        float oscillation = sinf(GetTime() * 2.0f); 
-        sideDirection = Vector2Scale(sideDirection, oscillation * enemy->speed * 0.7f);
+    batch->capacity = capacity;
+    return true;
+}
+
+static void addToBatch(EnemyBatch *batch, Enemy *enemy) {
+    int i = batch->count++;
+    batch->enemies[i] = enemy;
+    batch->x[i] = enemy->position.x;
+    batch->y[i] = enemy->position.y;
+    batch->speed[i] = enemy->speed;
+    batch->timer[i] = enemy->shootTimer;
+}
+
+// Zera as posições de sobra até o múltiplo de ENEMY_BATCH_LANES
+static void padBatch(EnemyBatch *batch) {
+    for (int i = batch->count; i < paddedCount(batch->count); i++) {
+        batch->enemies[i] = NULL;
+        batch->x[i] = 0.0f;
+        batch->y[i] = 0.0f;
+        batch->dirX[i] = 0.0f;
+        batch->dirY[i] = 0.0f;
+        batch->speed[i] = 0.0f;
+        batch->timer[i] = 0.0f;
+    }
+}
+
+// Kernels: recebem os vetores como parâmetros restrict (o compilador só confia
+// no restrict de parâmetros) e percorrem o tamanho arredondado do lote
+
+// Move pela velocidade em vx/vy e prende na tela. Comparações em vez de
+// fminf/fmaxf viram min/max vetoriais sem -ffast-math.
+static void moveKernel(float *restrict x, float *restrict y, const float *restrict vx, const float *restrict vy,
+                       int batchCount, float deltaTime, float screenWidth, float screenHeight) {
+    int count = paddedCount(batchCount);
+    for (int i = 0; i < count; i++) {
+        float newX = x[i] + vx[i] * deltaTime;
+        float newY = y[i] + vy[i] * deltaTime;
+        newX = (newX < 0.0f) ? 0.0f : newX;
+        newY = (newY < 0.0f) ? 0.0f : newY;
+        x[i] = (newX > screenWidth) ? screenWidth : newX;
+        y[i] = (newY > screenHeight) ? screenHeight : newY;
+    }
+}
+
+// Normaliza a direção e escala pela velocidade sem desvio: direção nula continua nula
+static void normalizeKernel(float *restrict dirX, float *restrict dirY, const float *restrict speed, int batchCount) {
+    int count = paddedCount(batchCount);
+    for (int i = 0; i < count; i++) {
+        float lengthSqr = dirX[i] * dirX[i] + dirY[i] * dirY[i];
+        float scale = speed[i] / sqrtf(lengthSqr + 1e-12f);
+        dirX[i] *= scale;
+        dirY[i] *= scale;
+    }
+}
+
+// Atiradores fogem de perto, se aproximam de longe e orbitam no meio; o
+// movimento e o disparo são escolhidos com seleções, sem desvios
+static void shooterKernel(const float *restrict x, const float *restrict y, const float *restrict speed,
+                          float *restrict dirX, float *restrict dirY, float *restrict timer, float *restrict fired,
+                          int batchCount, Vector2 playerPosition, float oscillation, float deltaTime) {
+    float sideSpeed = oscillation * 0.7f;
+    int count = paddedCount(batchCount);
+    for (int i = 0; i < count; i++) {
+        float toX = playerPosition.x - x[i];
+        float toY = playerPosition.y - y[i];
+        float distance = sqrtf(toX * toX + toY * toY);
+        float inverse = 1.0f / (distance + 1e-12f);
+        float unitX = toX * inverse;
+        float unitY = toY * inverse;
         
+        // '&' em vez de '&&' para não gerar desvio
+        int orbiting = (distance >= 200.0f) & (distance <= 450.0f);
+        float along = (distance < 200.0f) ? -1.2f : 0.8f;
+        along = orbiting ? -0.3f : along;
+        float across = orbiting ? sideSpeed : 0.0f;
+        dirX[i] = (unitX * along - unitY * across) * speed[i];
+        dirY[i] = (unitY * along + unitX * across) * speed[i];
         
-        Vector2 backDirection = Vector2Scale(Vector2Normalize(directionToPlayer), -enemy->speed * 0.3f);
-        enemy->velocity = Vector2Add(sideDirection, backDirection);
+        float elapsed = timer[i] + deltaTime;
+        int fires = (elapsed >= 1.0f) & (distance < 500.0f);
+        timer[i] = fires ? 0.0f : elapsed;
+        fired[i] = fires ? 1.0f : 0.0f;
+    }
+}
+
+static void writeBackBatch(const EnemyBatch *batch) {
+    for (int i = 0; i < batch->count; i++) {
+        Enemy *enemy = batch->enemies[i];
+        enemy->position = (Vector2){ batch->x[i], batch->y[i] };
+        enemy->velocity = (Vector2){ batch->dirX[i], batch->dirY[i] };
+        enemy->shootTimer = batch->timer[i];
+    }
+}
+
+// Perseguidores (normal, speeder, tank, exploder): a direção vem do campo de
+// fluxo mais o afastamento; normalizar e mover ficam nos kernels
+static void updateChaserBatch(EnemyBatch *batch, float deltaTime, float screenWidth, float screenHeight) {
+    for (int i = 0; i < batch->count; i++) {
+        Vector2 direction = SampleFlowField((Vector2){ batch->x[i], batch->y[i] });
+        if (separationEnabled) {
+            Vector2 push = separationFrom(batch->enemies[i]);
+            direction.x += push.x * ENEMY_SEPARATION_WEIGHT;
+            direction.y += push.y * ENEMY_SEPARATION_WEIGHT;
+        }
+        batch->dirX[i] = direction.x;
+        batch->dirY[i] = direction.y;
     }
     
+    normalizeKernel(batch->dirX, batch->dirY, batch->speed, batch->count);
+    moveKernel(batch->x, batch->y, batch->dirX, batch->dirY, batch->count, deltaTime, screenWidth, screenHeight);
+}
+
+// Os disparos do kernel viram pedidos e são criados depois, todos de uma vez
+static void updateShooterBatch(EnemyBatch *batch, Vector2 playerPosition, float deltaTime,
+                               float screenWidth, float screenHeight, BulletList *enemyBullets) {
+    // A oscilação lateral é a mesma para todos no quadro
+    float oscillation = sinf(GetTime() * 2.0f);
     
-    if (enemy->shootTimer >= 1.0f && distanceToPlayer < 500.0f) {
-        enemy->shootTimer = 0.0f;
-        
-        
-        if (Vector2LengthSqr(directionToPlayer) > 0) {
-            
-            float angleVariation = GetRandomValue(-5, 5) * 0.01f; 
-            float currentAngle = atan2f(directionToPlayer.y, directionToPlayer.x);
-            float newAngle = currentAngle + angleVariation;
-            
-            Vector2 shootDirection = {
-                cosf(newAngle),
-                sinf(newAngle)
-            };
-            
-            AddBullet(enemyBullets, enemy->position, shootDirection, false); // Tiro de inimigo
-        }
+    shooterKernel(batch->x, batch->y, batch->speed, batch->dirX, batch->dirY, batch->timer, batch->fired,
+                  batch->count, playerPosition, oscillation, deltaTime);
+    
+    // Os disparos saem da posição de antes do movimento
+    int shotCount = 0;
+    for (int i = 0; i < batch->count; i++) {
+        float toX = playerPosition.x - batch->x[i];
+        float toY = playerPosition.y - batch->y[i];
+        if (batch->fired[i] == 0.0f || (toX == 0.0f && toY == 0.0f)) continue;
+        float inverse = 1.0f / sqrtf(toX * toX + toY * toY);
+        shotRequests[shotCount++] = (ShotRequest){ { batch->x[i], batch->y[i] }, { toX * inverse, toY * inverse } };
     }
     
+    // Imprecisão de ±0.05 rad: a mira é girada pela tabela, sem atan2f/cosf/sinf
+    const BulletArchetype *shot = GetBulletArchetype(BULLET_KIND_STANDARD);
+    for (int i = 0; i < shotCount; i++) {
+        Vector2 jitter = DirectionFromAngle(AngleFromRadians(GetRandomValue(-5, 5) * 0.01f));
+        Vector2 direction = RotateDirection(shotRequests[i].aim, jitter);
+        EmitBullets(enemyBullets, shot, BULLET_NO_MODIFIERS, shotRequests[i].origin, &direction, 1); // Tiro de inimigo
+    }
     
-    enemy->position.x += enemy->velocity.x * deltaTime;
-    enemy->position.y += enemy->velocity.y * deltaTime;
+    moveKernel(batch->x, batch->y, batch->dirX, batch->dirY, batch->count, deltaTime, screenWidth, screenHeight);
 }
 
 void UpdateEnemies(EnemyList *list, Vector2 playerPosition, float deltaTime, 
                   int screenWidth, int screenHeight, 
-                  Bullet **playerBullets, Bullet **enemyBullets) {
-    Enemy *currentEnemy = list->head;
-    Enemy *prevEnemy = NULL;
+                  BulletList *playerBullets, BulletList *enemyBullets) {
+    (void)playerBullets;
     
+    UpdateFlowField(playerPosition, screenWidth, screenHeight);
+    
+    // A grade serve à separação e às balas teleguiadas, então é feita sempre
+    BeginSpatialGrid(&enemyGrid, (float)screenWidth, (float)screenHeight, ENEMY_GRID_CELL);
+    for (Enemy *enemy = list->head; enemy != NULL; enemy = enemy->next) {
+        if (enemy->active) {
+            AddToSpatialGrid(&enemyGrid, enemy, enemy->position, enemy->radius);
+        }
+    }
+    EndSpatialGrid(&enemyGrid);
+    
+    // Separa os vivos por comportamento em lotes densos; cada lote roda seu kernel
+    chasers.count = 0;
+    shooters.count = 0;
+    if (!reserveBatch(&chasers, list->count) || !reserveBatch(&shooters, list->count) ||
+        !reserveShotRequests(list->count)) {
+        return;
+    }
+    for (Enemy *enemy = list->head; enemy != NULL; enemy = enemy->next) {
+        if (!enemy->active) continue;
+        addToBatch(enemy->type == ENEMY_TYPE_SHOOTER ? &shooters : &chasers, enemy);
+    }
+    padBatch(&chasers);
+    padBatch(&shooters);
+    
+    updateChaserBatch(&chasers, deltaTime, (float)screenWidth, (float)screenHeight);
+    updateShooterBatch(&shooters, playerPosition, deltaTime, (float)screenWidth, (float)screenHeight, enemyBullets);
+    writeBackBatch(&chasers);
+    writeBackBatch(&shooters);
+    
+    // Animações de morte e remoção dos que terminaram
+    Enemy *currentEnemy = list->head;
     while (currentEnemy != NULL) {
         // VERIFICAÇÃO DE SEGURANÇA 
         if ((uintptr_t)currentEnemy < 1024) {
@@ -147,27 +368,7 @@ void UpdateEnemies(EnemyList *list, Vector2 playerPosition, float deltaTime,
         // Guarde o próximo inimigo de forma segura
         Enemy *nextEnemy = currentEnemy->next;
         
-        if (currentEnemy->active) {
-            
-            switch (currentEnemy->type) {
-                case ENEMY_TYPE_SPEEDER:
-                case ENEMY_TYPE_TANK:
-                case ENEMY_TYPE_NORMAL:
-                case ENEMY_TYPE_EXPLODER:
-                    UpdateNormalEnemy(currentEnemy, playerPosition, deltaTime);
-                    break;
-                case ENEMY_TYPE_SHOOTER:
-                    UpdateShooterEnemy(currentEnemy, playerPosition, deltaTime, enemyBullets);
-                    break;
-            }
-            
-            
-            if (currentEnemy->position.x < 0) currentEnemy->position.x = 0;
-            if (currentEnemy->position.y < 0) currentEnemy->position.y = 0;
-            if (currentEnemy->position.x > screenWidth) currentEnemy->position.x = screenWidth;
-            if (currentEnemy->position.y > screenHeight) currentEnemy->position.y = screenHeight;
-        }
-        else if (currentEnemy->isDying) {
+        if (!currentEnemy->active && currentEnemy->isDying) {
             
             currentEnemy->deathTimer += deltaTime;
             
@@ -193,7 +394,6 @@ void UpdateEnemies(EnemyList *list, Vector2 playerPosition, float deltaTime,
             }
         }
         
-        prevEnemy = currentEnemy;
         currentEnemy = nextEnemy; // Use a referência salva anteriormente
     }
 }
@@ -8,6 +8,12 @@
 
 #define DEATH_ANIMATION_DURATION 0.8f 
 
+// Separação entre perseguidores (consultada na grade de broadphase)
+#define ENEMY_GRID_CELL 64.0f             // >= maior diâmetro de inimigo
+#define ENEMY_SEPARATION_MARGIN 4.0f      // folga entre as bordas
+#define ENEMY_SEPARATION_WEIGHT 1.5f      // peso do afastamento contra o campo de fluxo
+#define ENEMY_SEPARATION_NEIGHBORS 16
+
 
 typedef enum {
     ENEMY_TYPE_NORMAL,   
@@ -17,6 +23,8 @@ typedef enum {
     ENEMY_TYPE_SHOOTER   
 } EnemyType;
 
+#define ENEMY_TYPE_COUNT 5
+
 typedef struct Enemy {
     Vector2 position;
     Vector2 velocity;
@@ -33,6 +41,8 @@ typedef struct Enemy {
     
     bool isDying;        
     float deathTimer;    
+    
+    unsigned int id;     // único na partida; as balas penetrantes guardam quem já atingiram
 } Enemy;
 
 typedef struct {
@@ -42,9 +52,17 @@ typedef struct {
 
 void InitEnemyList(EnemyList *list);
 void AddEnemy(EnemyList *list, Vector2 position, float radius, float speed, Color color, EnemyType type);
-void UpdateEnemies(EnemyList *list, Vector2 playerPosition, float deltaTime, int screenWidth, int screenHeight, Bullet **playerBullets, Bullet **enemyBullets);
+void UpdateEnemies(EnemyList *list, Vector2 playerPosition, float deltaTime, int screenWidth, int screenHeight, BulletList *playerBullets, BulletList *enemyBullets);
 void DrawEnemies(const EnemyList *list);
 void RemoveEnemy(EnemyList *list, Enemy *toRemove);
 void FreeEnemies(EnemyList *list);
 
+// Liga o afastamento entre inimigos que perseguem o jogador (ligado por padrão)
+void SetEnemySeparation(bool enabled);
+bool IsEnemySeparationEnabled(void);
+
+// Posição do inimigo ativo mais perto de position, até range, pela grade do
+// quadro. Vale entre UpdateEnemies e HandleCollisions (que libera inimigos).
+bool FindNearestEnemy(Vector2 position, float range, Vector2 *target);
+
 #endif 
\ No newline at end of file
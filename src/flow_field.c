@@ -0,0 +1,86 @@
+#include "flow_field.h"
+#include <math.h>
+#include <stdlib.h>
+
+
+static Vector2 directions[FLOW_MAX_ROWS][FLOW_MAX_COLUMNS];
+static int columns = 0;
+static int rows = 0;
+static int targetColumn = -1;
+static int targetRow = -1;
+static Vector2 currentTarget = { 0 };
+
+
+static int clampIndex(int value, int count) {
+    if (value < 0) return 0;
+    if (value >= count) return count - 1;
+    return value;
+}
+
+static Vector2 unitToward(float fromX, float fromY, Vector2 to) {
+    float dx = to.x - fromX;
+    float dy = to.y - fromY;
+    float lengthSqr = dx * dx + dy * dy;
+    if (lengthSqr <= 0.0f) {
+        return (Vector2){ 0.0f, 0.0f };
+    }
+    
+    float inverse = 1.0f / sqrtf(lengthSqr);
+    return (Vector2){ dx * inverse, dy * inverse };
+}
+
+static void rebuildField(void) {
+    Vector2 cellTarget = {
+        (targetColumn + 0.5f) * FLOW_CELL_SIZE,
+        (targetRow + 0.5f) * FLOW_CELL_SIZE
+    };
+    
+    for (int row = 0; row < rows; row++) {
+        float centerY = (row + 0.5f) * FLOW_CELL_SIZE;
+        for (int column = 0; column < columns; column++) {
+            float centerX = (column + 0.5f) * FLOW_CELL_SIZE;
+            directions[row][column] = unitToward(centerX, centerY, cellTarget);
+        }
+    }
+}
+
+
+void UpdateFlowField(Vector2 target, int screenWidth, int screenHeight) {
+    int newColumns = (int)ceilf(screenWidth / FLOW_CELL_SIZE);
+    int newRows = (int)ceilf(screenHeight / FLOW_CELL_SIZE);
+    if (newColumns > FLOW_MAX_COLUMNS) newColumns = FLOW_MAX_COLUMNS;
+    if (newRows > FLOW_MAX_ROWS) newRows = FLOW_MAX_ROWS;
+    if (newColumns < 1) newColumns = 1;
+    if (newRows < 1) newRows = 1;
+    
+    int column = clampIndex((int)floorf(target.x / FLOW_CELL_SIZE), newColumns);
+    int row = clampIndex((int)floorf(target.y / FLOW_CELL_SIZE), newRows);
+    currentTarget = target;
+    
+    if (column == targetColumn && row == targetRow && newColumns == columns && newRows == rows) {
+        return;
+    }
+    
+    columns = newColumns;
+    rows = newRows;
+    targetColumn = column;
+    targetRow = row;
+    rebuildField();
+}
+
+
+Vector2 SampleFlowField(Vector2 position) {
+    if (columns == 0) {
+        return unitToward(position.x, position.y, currentTarget);
+    }
+    
+    int column = clampIndex((int)floorf(position.x / FLOW_CELL_SIZE), columns);
+    int row = clampIndex((int)floorf(position.y / FLOW_CELL_SIZE), rows);
+    
+    // Perto do alvo o erro de quantização do campo vira órbita: usar a reta exata
+    if (abs(column - targetColumn) <= FLOW_EXACT_CELLS && abs(row - targetRow) <= FLOW_EXACT_CELLS) {
+        return unitToward(position.x, position.y, currentTarget);
+    }
+    
+    return directions[row][column];
+}
@@ -0,0 +1,20 @@
+#ifndef FLOW_FIELD_H
+#define FLOW_FIELD_H
+
+#include "raylib.h"
+
+#define FLOW_CELL_SIZE 32.0f
+#define FLOW_MAX_COLUMNS 128
+#define FLOW_MAX_ROWS 128
+#define FLOW_EXACT_CELLS 2           // perto do alvo a direção é calculada exata
+
+// Campo de direções unitárias rumo ao jogador, uma por célula da tela.
+// A arena não tem obstáculos, então o caminho de menor custo de cada célula é
+// a reta até a célula do alvo: o campo só é refeito quando o alvo muda de
+// célula (ou a tela muda de tamanho), e cada perseguidor faz uma consulta.
+void UpdateFlowField(Vector2 target, int screenWidth, int screenHeight);
+
+// Direção unitária a seguir a partir de position (zero em cima do alvo)
+Vector2 SampleFlowField(Vector2 position);
+
+#endif
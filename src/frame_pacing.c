@@ -0,0 +1,236 @@
+#include "frame_pacing.h"
+#include "raylib.h"
+#include "utils.h"
+#include "text_cache.h"
+#include <math.h>
+#include <stdio.h>
+
+
+#define IDLE_WAIT_SLICE 0.005  // intervalo entre verificações de entrada no modo ocioso
+#define OVERLAY_REFRESH 0.5f   // o texto da sobreposição muda só duas vezes por segundo
+
+
+static FramePacingMode pacingMode = FRAME_PACING_CAPPED;
+static int appliedTargetFps = -1;
+static bool vsyncEnabled = false;
+
+static bool idle = false;
+static float idleTimer = 0.0f;
+static double idleFrameStart = 0.0;
+static bool skipNextSample = false;
+
+static float frameSamples[FRAME_STATS_SAMPLES];
+static int sampleCount = 0;
+static int sampleNext = 0;
+
+static bool overlayVisible = false;
+static float overlayTimer = 0.0f;
+static char overlayText[128] = "";
+
+
+static void applyTargetFps(int fps) {
+    if (fps != appliedTargetFps) {
+        SetTargetFPS(fps);
+        appliedTargetFps = fps;
+    }
+}
+
+static void applyVsync(bool enabled) {
+    if (enabled == vsyncEnabled) return;
+    
+    if (enabled) {
+        SetWindowState(FLAG_VSYNC_HINT);
+    } else {
+        ClearWindowState(FLAG_VSYNC_HINT);
+    }
+    vsyncEnabled = enabled;
+}
+
+// Verifica a entrada sem consumir as filas de teclas e caracteres do raylib
+static bool hasUserInput(void) {
+    for (int key = KEY_SPACE; key <= KEY_KB_MENU; key++) {
+        if (IsKeyDown(key)) return true;
+    }
+    
+    for (int button = MOUSE_BUTTON_LEFT; button <= MOUSE_BUTTON_BACK; button++) {
+        if (IsMouseButtonDown(button)) return true;
+    }
+    
+    Vector2 mouseDelta = GetMouseDelta();
+    if (mouseDelta.x != 0.0f || mouseDelta.y != 0.0f) return true;
+    if (GetMouseWheelMove() != 0.0f) return true;
+    
+    if (IsGamepadAvailable(0) && GetGamepadButtonPressed() != GAMEPAD_BUTTON_UNKNOWN) return true;
+    
+    return false;
+}
+
+static void wakeUp(void) {
+    idle = false;
+    idleTimer = 0.0f;
+    // O quadro em que acorda inclui a espera ociosa: não entra nas medidas
+    skipNextSample = true;
+}
+
+static void recordFrameTime(float frameTime) {
+    frameSamples[sampleNext] = frameTime;
+    sampleNext = (sampleNext + 1) % FRAME_STATS_SAMPLES;
+    if (sampleCount < FRAME_STATS_SAMPLES) sampleCount++;
+}
+
+
+void InitFramePacing(void) {
+    pacingMode = FRAME_PACING_CAPPED;
+    applyTargetFps(TARGET_FPS);
+}
+
+
+void SetFramePacingMode(FramePacingMode mode) {
+    if (mode < 0 || mode >= FRAME_PACING_MODE_COUNT) return;
+    
+    pacingMode = mode;
+    // Os tempos do modo anterior não servem para comparar com o novo
+    sampleCount = 0;
+    sampleNext = 0;
+}
+
+
+FramePacingMode GetFramePacingMode(void) {
+    return pacingMode;
+}
+
+
+const char *GetFramePacingModeName(FramePacingMode mode) {
+    switch (mode) {
+        case FRAME_PACING_VSYNC:    return "VSYNC";
+        case FRAME_PACING_UNCAPPED: return "SEM LIMITE";
+        case FRAME_PACING_CAPPED:
+        default:                    return "60 FPS";
+    }
+}
+
+
+void BeginFramePacing(bool staticScreen) {
+    float frameTime = GetFrameTime();
+    
+    if (skipNextSample || idle) {
+        skipNextSample = false;
+    } else {
+        recordFrameTime(frameTime);
+    }
+    
+    if (!staticScreen) {
+        if (idle) wakeUp();
+        idleTimer = 0.0f;
+        
+        applyVsync(pacingMode == FRAME_PACING_VSYNC);
+        applyTargetFps(pacingMode == FRAME_PACING_CAPPED ? TARGET_FPS : 0);
+        return;
+    }
+    
+    // Telas estáticas não precisam de mais que a taxa normal, qualquer que seja o modo
+    applyVsync(false);
+    
+    if (hasUserInput()) {
+        if (idle) wakeUp();
+        idleTimer = 0.0f;
+    } else if (!idle) {
+        idleTimer += frameTime;
+        if (idleTimer >= IDLE_DELAY) {
+            idle = true;
+        }
+    }
+    
+    if (idle) {
+        // A espera fica com FramePacingShouldWait, que pode ser interrompida pela entrada
+        applyTargetFps(0);
+        idleFrameStart = GetTime();
+    } else {
+        applyTargetFps(TARGET_FPS);
+    }
+}
+
+
+bool FramePacingShouldWait(void) {
+    if (!idle) return false;
+    
+    if (GetTime() - idleFrameStart >= 1.0 / IDLE_FPS) {
+        return false;
+    }
+    
+    WaitTime(IDLE_WAIT_SLICE);
+    PollInputEvents();
+    
+    // Sem nova verificação depois desta: o evento fica para o próximo UpdateGame
+    if (hasUserInput()) {
+        wakeUp();
+        return false;
+    }
+    
+    return true;
+}
+
+
+bool IsFramePacingIdle(void) {
+    return idle;
+}
+
+
+void GetFramePacingStats(FramePacingStats *stats) {
+    stats->samples = sampleCount;
+    stats->averageMs = 0.0f;
+    stats->jitterMs = 0.0f;
+    stats->worstMs = 0.0f;
+    stats->fps = 0.0f;
+    
+    if (sampleCount == 0) return;
+    
+    double sum = 0.0;
+    float worst = 0.0f;
+    for (int i = 0; i < sampleCount; i++) {
+        sum += frameSamples[i];
+        if (frameSamples[i] > worst) worst = frameSamples[i];
+    }
+    double mean = sum / sampleCount;
+    
+    double variance = 0.0;
+    for (int i = 0; i < sampleCount; i++) {
+        double diff = frameSamples[i] - mean;
+        variance += diff * diff;
+    }
+    variance /= sampleCount;
+    
+    stats->averageMs = (float)(mean * 1000.0);
+    stats->jitterMs = (float)(sqrt(variance) * 1000.0);
+    stats->worstMs = worst * 1000.0f;
+    stats->fps = mean > 0.0 ? (float)(1.0 / mean) : 0.0f;
+}
+
+
+void SetFramePacingOverlay(bool visible) {
+    overlayVisible = visible;
+    overlayTimer = 0.0f;
+}
+
+
+bool IsFramePacingOverlayVisible(void) {
+    return overlayVisible;
+}
+
+
+void DrawFramePacingOverlay(void) {
+    if (!overlayVisible) return;
+    
+    overlayTimer -= GetFrameTime();
+    if (overlayTimer <= 0.0f) {
+        FramePacingStats stats;
+        GetFramePacingStats(&stats);
+        snprintf(overlayText, sizeof(overlayText), "%s%s  %.0f FPS  %.2f ms  jitter %.2f ms  pior %.2f ms",
+                 GetFramePacingModeName(pacingMode), idle ? " (ocioso)" : "",
+                 stats.fps, stats.averageMs, stats.jitterMs, stats.worstMs);
+        overlayTimer = OVERLAY_REFRESH;
+    }
+    
+    int width = MeasureCachedText(overlayText, 20);
+    DrawCachedTextShadow(overlayText, GetScreenWidth() - width - 10, 10, 20, GREEN, 2, BLACK);
+}
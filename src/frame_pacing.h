@@ -0,0 +1,50 @@
+#ifndef FRAME_PACING_H
+#define FRAME_PACING_H
+
+#include <stdbool.h>
+
+#define IDLE_FPS 10            // taxa das telas estáticas sem interação
+#define IDLE_DELAY 3.0f        // segundos sem entrada até reduzir a taxa
+#define FRAME_STATS_SAMPLES 240
+
+// Como o jogo roda durante a partida; telas estáticas ficam sempre em TARGET_FPS
+typedef enum {
+    FRAME_PACING_CAPPED = 0,   // SetTargetFPS(TARGET_FPS)
+    FRAME_PACING_VSYNC,        // sincronizado com o monitor, sem espera na CPU
+    FRAME_PACING_UNCAPPED,     // sem limite (medições e monitores rápidos)
+    FRAME_PACING_MODE_COUNT
+} FramePacingMode;
+
+// Medidas dos últimos quadros ativos (quadros ociosos ficam de fora)
+typedef struct {
+    float averageMs;
+    float jitterMs;            // desvio padrão do tempo de quadro
+    float worstMs;
+    float fps;
+    int samples;
+} FramePacingStats;
+
+void InitFramePacing(void);
+
+void SetFramePacingMode(FramePacingMode mode);
+FramePacingMode GetFramePacingMode(void);
+const char *GetFramePacingModeName(FramePacingMode mode);
+
+// Chamado no início de cada quadro. staticScreen indica menus, pausa e ranking:
+// depois de IDLE_DELAY sem entrada essas telas passam para IDLE_FPS.
+void BeginFramePacing(bool staticScreen);
+
+// Chamado depois de EndDrawing enquanto retornar true. No modo ocioso espera
+// em fatias curtas e volta na hora em que houver entrada; o chamador usa cada
+// volta para alimentar o que não pode parar (streams de música).
+bool FramePacingShouldWait(void);
+
+bool IsFramePacingIdle(void);
+void GetFramePacingStats(FramePacingStats *stats);
+
+// Sobreposição com modo e medidas (F6)
+void SetFramePacingOverlay(bool visible);
+bool IsFramePacingOverlayVisible(void);
+void DrawFramePacingOverlay(void);
+
+#endif
@@ -5,6 +5,7 @@
 #include "player.h"
 #include "enemy.h"
 #include "bullet.h"
+#include "direction_table.h"
 #include "audio.h"
 #include "render.h"
 #include "scoreboard.h"
@@ -12,13 +13,27 @@
 #include <string.h> 
 #include <stdio.h>
 #include "narrative_text.h"
+#include "text_cache.h"
+#include "screen_cache.h"
+#include "telemetry.h"
+#include "spawn_table.h"
 
 
 extern float currentPlayAreaRadius;
 
-bool increasedDamage = false;  // Definição global da variável
+// Partida aberta na telemetria: fecha como abandonada se o jogo reiniciar ou voltar ao menu
+static bool telemetryRunOpen = false;
+
+static void endTelemetryRun(const Game *game, TelemetryRunEnd reason) {
+    if (!telemetryRunOpen) return;
+    
+    RecordTelemetryEvent(TELEMETRY_RUN_END, reason, game->gameTime, (unsigned int)game->score);
+    telemetryRunOpen = false;
+}
 
 void ResetGame(Game *game) {
+    endTelemetryRun(game, TELEMETRY_RUN_END_ABANDONED);
+    
     
     Enemy *currentEnemy = game->enemies.head;
     while (currentEnemy != NULL) {
@@ -30,22 +45,8 @@ void ResetGame(Game *game) {
     game->enemies.count = 0;
 
     
-    Bullet *currentBullet = game->bullets;
-    while (currentBullet != NULL) {
-        Bullet *nextBullet = currentBullet->next;
-        free(currentBullet);
-        currentBullet = nextBullet;
-    }
-    game->bullets = NULL;
-    
-    
-    currentBullet = game->enemyBullets;
-    while (currentBullet != NULL) {
-        Bullet *nextBullet = currentBullet->next;
-        free(currentBullet);
-        currentBullet = nextBullet;
-    }
-    game->enemyBullets = NULL;
+    ClearBullets(&game->bullets);
+    ClearBullets(&game->enemyBullets);
 
     
     InitPlayer(&game->player, SCREEN_WIDTH, SCREEN_HEIGHT);
@@ -54,20 +55,16 @@ void ResetGame(Game *game) {
     game->score = 0;
 
     
-    game->enemySpawnTimer = 0.0f;
-    game->enemySpawnInterval = 1.5f; 
-    game->difficultyTimer = 0.0f;
+    ResetWaveScheduler(&game->waves);
     game->shootCooldown = 0.0f;  
 
     
     game->currentState = GAME_STATE_PLAYING;
+    // O diretor só pausa as faixas; uma partida nova começa do início delas
+    RewindGameMusic(game->backgroundMusic);
+    RewindGameMusic(game->bossMusic);
 
     
-    if (IsAudioDeviceReady() && game->backgroundMusic.ctxData != NULL) {
-        StopMusicStream(game->backgroundMusic);
-        PlayMusicStream(game->backgroundMusic);
-    }
-    
     
     ClearPowerups(&game->powerups);
     
@@ -75,8 +72,6 @@ void ResetGame(Game *game) {
     game->enemiesKilled = 0;
     game->nextPowerupAt = 10;
     game->increasedDamage = false;
-    
-    increasedDamage = false;  // Reinicia o dano da bala para o padrão
 
     
     game->bossActive = false;
@@ -92,124 +87,52 @@ void ResetGame(Game *game) {
     
     game->gameTime = 0.0f;
     game->showGameSummary = false;
-}
-
-void UpdateDifficulty(Game *game, float deltaTime) {
-    game->difficultyTimer += deltaTime;
     
-    if (game->difficultyTimer > 10.0f) {
-        game->enemySpawnInterval *= 0.90f; 
-        if (game->enemySpawnInterval < 0.2f) { 
-            game->enemySpawnInterval = 0.2f;
-        }
-        game->difficultyTimer = 0.0f; 
-        
-    }
+    RecordTelemetryEvent(TELEMETRY_RUN_START, 0, 0.0f, 0);
+    telemetryRunOpen = true;
 }
 
-void SpawnEnemy(Game *game) {
+// Cria os inimigos vencidos na fila de ondas, no máximo WAVE_SPAWNS_PER_TICK por
+// quadro: numa rajada o excesso fica para os próximos quadros
+void SpawnEnemy(Game *game, float deltaTime) {
+    UpdateWaveScheduler(&game->waves, deltaTime, game->bossActive, game->score);
     
-    if (game->bossActive) return;
-
-    game->enemySpawnTimer += GetFrameTime();
-    if (game->enemySpawnTimer >= game->enemySpawnInterval) {
-        game->enemySpawnTimer = 0.0f;
-
-        Vector2 spawnPosition;
-        int side = GetRandomValue(0, 3); 
-
-        
-        EnemyType type;
-        int randomType = GetRandomValue(1, 100);
-        
-        
-        if (game->score < 1000) {
-            
-            type = ENEMY_TYPE_NORMAL;
-        } 
-        else if (game->score < 2000) {
-            
-            if (randomType <= 50) type = ENEMY_TYPE_NORMAL;
-            else if (randomType <= 60) type = ENEMY_TYPE_SHOOTER; 
-            else if (randomType <= 85) type = ENEMY_TYPE_TANK;
-            else type = ENEMY_TYPE_EXPLODER;
-        }
-        else if (game->score < 3000) {
-            
-            if (randomType <= 35) type = ENEMY_TYPE_NORMAL;
-            else if (randomType <= 45) type = ENEMY_TYPE_SHOOTER; 
-            else if (randomType <= 75) type = ENEMY_TYPE_TANK;
-            else if (randomType <= 90) type = ENEMY_TYPE_EXPLODER;
-            else type = ENEMY_TYPE_SPEEDER;
-        }
-        else {
-            
-            if (randomType <= 20) type = ENEMY_TYPE_NORMAL;
-            else if (randomType <= 25) type = ENEMY_TYPE_SHOOTER; 
-            else if (randomType <= 55) type = ENEMY_TYPE_TANK;
-            else if (randomType <= 85) type = ENEMY_TYPE_EXPLODER;
-            else type = ENEMY_TYPE_SPEEDER;
-        }
-        
-        
-        float radius;
-        float speed;
+    SpawnEvent event;
+    int spawned = 0;
+    while (spawned < WAVE_SPAWNS_PER_TICK && PopDueSpawn(&game->waves, &event)) {
+        Vector2 spawnPosition = { 0 };
+        float radius = event.radius;
         
-        switch (type) {
-            case ENEMY_TYPE_SPEEDER:
-                radius = ENEMY_RADIUS_MIN;
-                speed = ENEMY_SPEED_MAX + (game->score / 1000.0f);
-                break;
-            case ENEMY_TYPE_TANK:
-                radius = ENEMY_RADIUS_MAX;
-                speed = ENEMY_SPEED_MIN + (game->score / 2000.0f);
-                break;
-            case ENEMY_TYPE_EXPLODER:
-                radius = ENEMY_RADIUS_MIN + 5.0f;
-                speed = ENEMY_SPEED_MIN + (ENEMY_SPEED_MAX / 2.0f) + (game->score / 1500.0f);
-                break;
-            case ENEMY_TYPE_SHOOTER:
-                radius = ENEMY_RADIUS_MIN + 3.0f;
-                speed = ENEMY_SPEED_MIN + (ENEMY_SPEED_MAX / 3.0f) + (game->score / 1800.0f);
-                break;
-            default: 
-                radius = GetRandomValue(ENEMY_RADIUS_MIN, ENEMY_RADIUS_MAX);
-                speed = GetRandomValue(ENEMY_SPEED_MIN, ENEMY_SPEED_MAX) + (game->score / 1000.0f);
-                break;
-        }
-        
-        
-        if (speed > ENEMY_SPEED_MAX * 2) speed = ENEMY_SPEED_MAX * 2;
-
-        
-        switch (side) {
+        // A borda é a atual: a área de jogo pode ter mudado desde o sorteio
+        switch (event.side) {
             case 0: 
                 spawnPosition = (Vector2){
-                    (float)GetRandomValue((int)PLAY_AREA_LEFT, (int)PLAY_AREA_RIGHT), 
+                    PLAY_AREA_LEFT + event.along * (PLAY_AREA_RIGHT - PLAY_AREA_LEFT), 
                     PLAY_AREA_TOP - radius - 10.0f
                 };
                 break;
             case 1: 
                 spawnPosition = (Vector2){
-                    (float)GetRandomValue((int)PLAY_AREA_LEFT, (int)PLAY_AREA_RIGHT), 
+                    PLAY_AREA_LEFT + event.along * (PLAY_AREA_RIGHT - PLAY_AREA_LEFT), 
                     PLAY_AREA_BOTTOM + radius + 10.0f
                 };
                 break;
             case 2: 
                 spawnPosition = (Vector2){
                     PLAY_AREA_LEFT - radius - 10.0f, 
-                    (float)GetRandomValue((int)PLAY_AREA_TOP, (int)PLAY_AREA_BOTTOM)
+                    PLAY_AREA_TOP + event.along * (PLAY_AREA_BOTTOM - PLAY_AREA_TOP)
                 };
                 break;
             case 3: 
                 spawnPosition = (Vector2){
                     PLAY_AREA_RIGHT + radius + 10.0f, 
-                    (float)GetRandomValue((int)PLAY_AREA_TOP, (int)PLAY_AREA_BOTTOM)
+                    PLAY_AREA_TOP + event.along * (PLAY_AREA_BOTTOM - PLAY_AREA_TOP)
                 };
                 break;
         }
         
-        AddEnemy(&game->enemies, spawnPosition, radius, speed, WHITE, type);
+        AddEnemy(&game->enemies, spawnPosition, radius, event.speed, WHITE, event.type);
+        spawned++;
     }
 }
 
@@ -222,70 +145,14 @@ void SpawnEnemies(Game *game) {
     
     for (int i = 0; i < enemiesToSpawn; i++) {
         
-        EnemyType type;
-        int randomType = GetRandomValue(1, 100);
-        
-        
-        if (game->score < 1000) {
-            
-            type = ENEMY_TYPE_NORMAL;
-        } 
-        else if (game->score < 2000) {
-            
-            if (randomType <= 50) type = ENEMY_TYPE_NORMAL;
-            else if (randomType <= 60) type = ENEMY_TYPE_SHOOTER; 
-            else if (randomType <= 85) type = ENEMY_TYPE_TANK;
-            else type = ENEMY_TYPE_EXPLODER;
-        }
-        else if (game->score < 3000) {
-            
-            if (randomType <= 35) type = ENEMY_TYPE_NORMAL;
-            else if (randomType <= 45) type = ENEMY_TYPE_SHOOTER; 
-            else if (randomType <= 75) type = ENEMY_TYPE_TANK;
-            else if (randomType <= 90) type = ENEMY_TYPE_EXPLODER;
-            else type = ENEMY_TYPE_SPEEDER;
-        }
-        else {
-            
-            if (randomType <= 20) type = ENEMY_TYPE_NORMAL;
-            else if (randomType <= 25) type = ENEMY_TYPE_SHOOTER; 
-            else if (randomType <= 55) type = ENEMY_TYPE_TANK;
-            else if (randomType <= 85) type = ENEMY_TYPE_EXPLODER;
-            else type = ENEMY_TYPE_SPEEDER;
-        }
-        
-        
-        float radius;
-        float speed;
-        
-        switch (type) {
-            case ENEMY_TYPE_SPEEDER:
-                radius = ENEMY_RADIUS_MIN;
-                speed = ENEMY_SPEED_MAX + (game->score / 1000.0f);
-                break;
-            case ENEMY_TYPE_TANK:
-                radius = ENEMY_RADIUS_MAX;
-                speed = ENEMY_SPEED_MIN + (game->score / 2000.0f);
-                break;
-            case ENEMY_TYPE_EXPLODER:
-                radius = ENEMY_RADIUS_MIN + 5.0f;
-                speed = ENEMY_SPEED_MIN + (ENEMY_SPEED_MAX / 2.0f) + (game->score / 1500.0f);
-                break;
-            case ENEMY_TYPE_SHOOTER:
-                radius = ENEMY_RADIUS_MIN + 3.0f;
-                speed = ENEMY_SPEED_MIN + (ENEMY_SPEED_MAX / 3.0f) + (game->score / 1800.0f);
-                break;
-            default: 
-                radius = GetRandomValue(ENEMY_RADIUS_MIN, ENEMY_RADIUS_MAX);
-                speed = GetRandomValue(ENEMY_SPEED_MIN, ENEMY_SPEED_MAX) + (game->score / 1000.0f);
-                break;
-        }
-        
-        
-        if (speed > ENEMY_SPEED_MAX * 2) speed = ENEMY_SPEED_MAX * 2;
+        // Tipo e atributos vêm da tabela de spawn (um sorteio de alias por inimigo)
+        SpawnSpec spec = RollSpawn(game->score);
+        EnemyType type = spec.type;
+        float radius = spec.radius;
+        float speed = spec.speed;
 
         
-        float angle = GetRandomValue(0, 360) * DEG2RAD;
+        float angle = SpawnRandomUnit() * 2.0f * PI;
         float spawnDistance = PLAY_AREA_RADIUS + radius + 20.0f; 
         
         Vector2 spawnPosition = {
@@ -297,6 +164,14 @@ void SpawnEnemies(Game *game) {
     }
 }
 
+// Power-up de dano do jogador: vale para qualquer tipo de tiro dele
+static BulletModifiers playerBulletModifiers(const Game *game) {
+    if (game->increasedDamage) {
+        return (BulletModifiers){ 2, 1.5f }; // Dano dobrado, projéteis maiores
+    }
+    return BULLET_NO_MODIFIERS;
+}
+
 void HandleInput(Game *game, float deltaTime) {
     // Atualizar cooldown de tiro
     if (game->shootCooldown > 0) {
@@ -310,6 +185,9 @@ void HandleInput(Game *game, float deltaTime) {
         Vector2 mousePos = GetMousePosition();
         Vector2 direction = Vector2Normalize(Vector2Subtract(mousePos, game->player.position));
         
+        const BulletArchetype *standard = GetBulletArchetype(BULLET_KIND_STANDARD);
+        BulletModifiers modifiers = playerBulletModifiers(game);
+        
         // Aplicar power-ups de tiro
         if (game->hasBossReward) {
             switch (game->activeBossReward) {
@@ -322,39 +200,51 @@ void HandleInput(Game *game, float deltaTime) {
                         Vector2 pos1 = Vector2Add(game->player.position, perpendicular);
                         Vector2 pos2 = Vector2Subtract(game->player.position, perpendicular);
                         
-                        AddBullet(&game->bullets, pos1, direction, true);
-                        AddBullet(&game->bullets, pos2, direction, true);
+                        EmitBullets(&game->bullets, standard, modifiers, pos1, &direction, 1);
+                        EmitBullets(&game->bullets, standard, modifiers, pos2, &direction, 1);
                     }
                     break;
                     
                 case BOSS_REWARD_TRIPLE_SHOT:
                     // Tiro triplo: três projéteis em leque
                     {
-                        AddBullet(&game->bullets, game->player.position, direction, true);
+                        // Gira a mira ±0.2 rad em vez de passar por atan2f/cosf/sinf
+                        Vector2 spread = DirectionFromAngle(AngleFromRadians(0.2f));
+                        Vector2 fan[3] = {
+                            direction,
+                            RotateDirection(direction, (Vector2){ spread.x, -spread.y }),
+                            RotateDirection(direction, spread)
+                        };
                         
-                        float angle1 = atan2f(direction.y, direction.x) - 0.2f;
-                        float angle2 = atan2f(direction.y, direction.x) + 0.2f;
-                        
-                        Vector2 dir1 = {cosf(angle1), sinf(angle1)};
-                        Vector2 dir2 = {cosf(angle2), sinf(angle2)};
-                        
-                        AddBullet(&game->bullets, game->player.position, dir1, true);
-                        AddBullet(&game->bullets, game->player.position, dir2, true);
+                        EmitBullets(&game->bullets, standard, modifiers, game->player.position, fan, 3);
                     }
                     break;
                     
                 case BOSS_REWARD_QUICANTE:
                     // Tiros que quicam uma vez na parede
-                    AddRicochetBullet(&game->bullets, game->player.position, direction);
+                    EmitBullets(&game->bullets, GetBulletArchetype(BULLET_KIND_RICOCHET), modifiers,
+                                game->player.position, &direction, 1);
+                    break;
+                    
+                case BOSS_REWARD_HOMING:
+                    // Tiros que curvam rumo ao inimigo mais perto
+                    EmitBullets(&game->bullets, GetBulletArchetype(BULLET_KIND_HOMING), modifiers,
+                                game->player.position, &direction, 1);
+                    break;
+                    
+                case BOSS_REWARD_PENETRATION:
+                    // Tiros que atravessam vários inimigos
+                    EmitBullets(&game->bullets, GetBulletArchetype(BULLET_KIND_PENETRATING), modifiers,
+                                game->player.position, &direction, 1);
                     break;
                     
                 default:
                     // Tiro normal
-                    AddBullet(&game->bullets, game->player.position, direction, true);
+                    EmitBullets(&game->bullets, standard, modifiers, game->player.position, &direction, 1);
             }
         } else {
             // Tiro normal quando não tem power-up
-            AddBullet(&game->bullets, game->player.position, direction, true);
+            EmitBullets(&game->bullets, standard, modifiers, game->player.position, &direction, 1);
         }
         
         PlayGameSound(game->shootSound);
@@ -369,28 +259,31 @@ void HandleInput(Game *game, float deltaTime) {
 }
 
 void HandleCollisions(Game *game) {
-    Bullet *currentBullet = game->bullets;
-    while (currentBullet != NULL) {
+    for (int b = 0; b < game->bullets.count; b++) {
+        Bullet *currentBullet = &game->bullets.items[b];
         if (currentBullet->active) {
             Enemy *currentEnemy = game->enemies.head;
             Enemy *prevEnemy = NULL;
             while (currentEnemy != NULL) {
                 if (currentEnemy->active) {
                     if (CheckCollisionCircles(currentBullet->position, currentBullet->radius,
-                                              currentEnemy->position, currentEnemy->radius)) {
+                                              currentEnemy->position, currentEnemy->radius) &&
+                        !BulletHasHit(currentBullet, currentEnemy->id)) {
                         PlayGameSound(game->enemyExplodeSound);
-                        currentBullet->active = false; 
+                        // Penetrantes seguem em frente até esgotar o conjunto de acertos
+                        if (!RegisterBulletHit(currentBullet, currentEnemy->id)) {
+                            currentBullet->active = false;
+                        }
                         
                         currentEnemy->health -= currentBullet->damage;
                         
                         if (currentEnemy->health <= 0) {
+                            RecordTelemetryEvent(TELEMETRY_KILL, currentEnemy->type, 0.0f, 0);
+                            
                             // Efeitos especiais para inimigos explodentes
                             if (currentEnemy->type == ENEMY_TYPE_EXPLODER) {
-                                for (int i = 0; i < 8; i++) {
-                                    float angle = i * (2.0f * PI / 8.0f);
-                                    Vector2 direction = {cosf(angle), sinf(angle)};
-                                    AddBullet(&game->enemyBullets, currentEnemy->position, direction, false);
-                                }
+                                EmitBullets(&game->enemyBullets, GetBulletArchetype(BULLET_KIND_STANDARD), BULLET_NO_MODIFIERS,
+                                            currentEnemy->position, GetDirectionRing(8), 8);
                             }
                             
                             // ✅ NOVO: Tocar som específico baseado no tipo do inimigo
@@ -467,9 +360,9 @@ void HandleCollisions(Game *game) {
                                 };
                                 
                                 
-                                AddPowerup(&game->powerups, pos1, POWERUP_DAMAGE);
-                                AddPowerup(&game->powerups, pos2, POWERUP_HEAL);
-                                AddPowerup(&game->powerups, pos3, POWERUP_SHIELD);
+                                Vector2 positions[3] = { pos1, pos2, pos3 };
+                                PowerupType types[3] = { POWERUP_DAMAGE, POWERUP_HEAL, POWERUP_SHIELD };
+                                AddPowerupGroup(&game->powerups, positions, types, 3);
                                 
                                 
                                 if (game->nextPowerupAt < 50) {
@@ -520,16 +413,12 @@ void HandleCollisions(Game *game) {
                                 
                                 game->bossActive = true;
                                 game->enemiesKilledSinceBoss = 0;
+                                RecordTelemetryEvent(TELEMETRY_BOSS_LAYER, randomLayer, 0.0f, 0);
                                 
                                 // Mostrar mensagem
                                 game->showBossMessage = true;
                                 game->bossMessageTimer = 0.0f;
                                 
-                                
-                                
-                                // Trocar a música
-                                StopMusicStream(game->backgroundMusic);
-                                PlayMusicStream(game->bossMusic);
                             }
                             
                             // Contabilizar para spawn do boss
@@ -546,7 +435,8 @@ void HandleCollisions(Game *game) {
                             currentEnemy = currentEnemy->next;
                         }
                         
-                        break; // Sair do loop de inimigos para esta bala
+                        // Sair do loop de inimigos para esta bala, a menos que ela atravesse
+                        if (!currentBullet->active) break;
                     } else {
                         // Se não houve colisão, continuar percorrendo
                         prevEnemy = currentEnemy;
@@ -559,32 +449,34 @@ void HandleCollisions(Game *game) {
                 }
             }
         }
-        currentBullet = currentBullet->next;
     }
 
     
     if (game->bossActive && game->boss.active) {
-        currentBullet = game->bullets;  
-        
-        while (currentBullet != NULL) {
-            if (currentBullet->active) {
+        for (int b = 0; b < game->bullets.count; b++) {
+            Bullet *currentBullet = &game->bullets.items[b];
+            if (currentBullet->active && !BulletHasHit(currentBullet, BULLET_TARGET_BOSS)) {
                 
                 if (CheckBossHitByBullet(&game->boss, currentBullet->position, currentBullet->radius, currentBullet->damage)) {
                     
                     PlayGameSound(game->enemyExplodeSound);
                     
                     
-                    currentBullet->active = false;
+                    if (!RegisterBulletHit(currentBullet, BULLET_TARGET_BOSS)) {
+                        currentBullet->active = false;
+                    }
                     
                     
                     if (!game->boss.active) {
                         game->bossActive = false;
                         game->score += 4000; 
+                        RecordTelemetryEvent(TELEMETRY_BOSS_LAYER, 0, 0.0f, 0);
                         
                         // Conceder recompensa aleatória ao jogador
-                        BossRewardType reward = GetRandomValue(1, 4); // Escolhe um power-up aleatório (1-5)
+                        BossRewardType reward = GetRandomValue(BOSS_REWARD_DOUBLE_SHOT, BOSS_REWARD_PENETRATION); // Escolhe um power-up aleatório
                         game->activeBossReward = reward;
                         game->hasBossReward = true;
+                        RecordTelemetryEvent(TELEMETRY_REWARD, reward, 0.0f, 0);
                         game->bossRewardTimer = 30.0f;
                         
                         // Mostrar mensagem sobre o power-up obtido
@@ -608,6 +500,14 @@ void HandleCollisions(Game *game) {
                                 rewardMessage = "TIRO TRIPLO OBTIDO!";
                                 rewardColor = GREEN;
                                 break;
+                            case BOSS_REWARD_HOMING:
+                                rewardMessage = "TIROS TELEGUIADOS OBTIDOS!";
+                                rewardColor = ORANGE;
+                                break;
+                            case BOSS_REWARD_PENETRATION:
+                                rewardMessage = "TIROS PENETRANTES OBTIDOS!";
+                                rewardColor = RED;
+                                break;
                             default:
                                 rewardMessage = "PODER ESPECIAL OBTIDO!";
                                 rewardColor = WHITE;
@@ -616,14 +516,9 @@ void HandleCollisions(Game *game) {
                         ShowScreenText(rewardMessage, 
                                       (Vector2){GetScreenWidth()/2, GetScreenHeight()/2}, 
                                       30, rewardColor, 4.0f, true);
-                        
-                       
-                          
-                        // Trocar música de volta para a normal
-                        StopMusicStream(game->bossMusic);
-                        PlayMusicStream(game->backgroundMusic);
                     } 
                     else if (game->boss.isTransitioning) {
+                        RecordTelemetryEvent(TELEMETRY_BOSS_LAYER, game->boss.currentLayer, 0.0f, 0);
                         
                         switch (game->boss.currentLayer + 1) { 
                             case 4: game->score += 1000; break; 
@@ -633,7 +528,6 @@ void HandleCollisions(Game *game) {
                     }
                 }
             }
-            currentBullet = currentBullet->next;
         }
         
         
@@ -651,6 +545,7 @@ void HandleCollisions(Game *game) {
                     
                     PlayGameSound(game->playerExplodeSound);
                     game->player.lives--;
+                    RecordTelemetryEvent(TELEMETRY_DAMAGE, TELEMETRY_DAMAGE_BOSS_CONTACT, 1.0f, game->player.lives);
                     
                     
                     const char* damageText = GetDamageText();
@@ -674,8 +569,8 @@ void HandleCollisions(Game *game) {
     }
 
     
-    currentBullet = game->enemyBullets;
-    while (currentBullet != NULL) {
+    for (int b = 0; b < game->enemyBullets.count; b++) {
+        Bullet *currentBullet = &game->enemyBullets.items[b];
         
         if (currentBullet->active && !game->player.isDashing) {  
             if (CheckCollisionCircles(game->player.position, game->player.radius,
@@ -703,6 +598,7 @@ void HandleCollisions(Game *game) {
                     
                     
                     game->player.lives--;
+                    RecordTelemetryEvent(TELEMETRY_DAMAGE, TELEMETRY_DAMAGE_ENEMY_BULLET, 1.0f, game->player.lives);
                     
                     
                     const char* damageText = GetDamageText();
@@ -726,7 +622,6 @@ void HandleCollisions(Game *game) {
                 break;
             }
         }
-        currentBullet = currentBullet->next;
     }
 
     
@@ -776,6 +671,7 @@ void HandleCollisions(Game *game) {
                     
                     
                     game->player.lives--;
+                    RecordTelemetryEvent(TELEMETRY_DAMAGE, TELEMETRY_DAMAGE_ENEMY_CONTACT, 1.0f, game->player.lives);
                     
                     
                     const char* damageText = GetDamageText();
@@ -810,13 +706,14 @@ void InitGame(Game *game) {
     
     
     InitPlayArea();
+    InitDirectionTables();
     
     
     InitEnemyList(&game->enemies);
     
     
-    game->bullets = NULL;
-    game->enemyBullets = NULL; 
+    InitBulletList(&game->bullets);
+    InitBulletList(&game->enemyBullets);
     
     
     game->score = 0;
@@ -825,9 +722,6 @@ void InitGame(Game *game) {
     game->currentState = GAME_STATE_MAIN_MENU;
     
     
-    game->enemySpawnTimer = 0.0f;
-    game->enemySpawnInterval = 1.5f;
-    game->difficultyTimer = 0.0f;
     game->shootCooldown = 0.0f;  
     
     
@@ -837,9 +731,14 @@ void InitGame(Game *game) {
                  &game->enemyExploderDeathSound, &game->enemyShooterDeathSound,
                  &game->dashSound, // Adicione esta linha
                  &game->backgroundMusic, &game->menuMusic, &game->tutorialMusic, 
-                 &game->pauseMusic, &game->gameOverMusic, &game->nameEntryMusic,
+                 &game->nameEntryMusic,
                  &game->bossMusic,
                  &game->menuClickSound, &game->powerupDamageSound, &game->powerupHealSound, &game->powerupShieldSound);
+    
+    // Depois do áudio: o pacote de assets já está aberto
+    LoadSpawnTable();
+    LoadBossPatterns();
+    ResetWaveScheduler(&game->waves);
 
     
     ShowCursor();
@@ -853,7 +752,6 @@ void InitGame(Game *game) {
     
     
     game->increasedDamage = false;
-    increasedDamage = false;  // Inicializa a variável global também
 
     
     game->bossActive = false;
@@ -876,9 +774,8 @@ void InitGame(Game *game) {
 
     
 
-    // Inicializar variáveis de fade da música
-    game->bossMusicFadeIn = false;
-    game->bossMusicFadeTimer = 0.0f;
+    // Diretor de música (crossfade entre os estados)
+    InitMusicDirector(&game->musicDirector);
 
     // Inicializar campos de recompensa do boss
     game->activeBossReward = BOSS_REWARD_NONE;
@@ -886,84 +783,44 @@ void InitGame(Game *game) {
     game->hasBossReward = false;
 }
 
-void UpdateGame(Game *game, float deltaTime) {
-    static GameState previousState = -1;
-    
-    // Verificar transição de estado
-    if (previousState != game->currentState) {
-        // Interromper qualquer música atual
-        StopMusicStream(game->backgroundMusic);
-        StopMusicStream(game->menuMusic);
-        StopMusicStream(game->tutorialMusic);
-        StopMusicStream(game->pauseMusic);
-        StopMusicStream(game->gameOverMusic);
-        StopMusicStream(game->nameEntryMusic);
-        
-        // Iniciar música para o novo estado
-        switch (game->currentState) {
-            case GAME_STATE_MAIN_MENU:
-                PlayMusicStream(game->menuMusic);
-                break;
-                
-            case GAME_STATE_TUTORIAL:
-                PlayMusicStream(game->tutorialMusic);
-                break;
-                
-            case GAME_STATE_PLAYING:
-                PlayMusicStream(game->backgroundMusic);
-                break;
-                
-            case GAME_STATE_PAUSED:
-                PlayMusicStream(game->pauseMusic);
-                break;
-                
-            case GAME_STATE_GAME_OVER:
-                // Usar a música do menu em vez da música de game over
-                PlayMusicStream(game->menuMusic);  // MODIFICADO: era game->gameOverMusic
-                break;
-                
-            case GAME_STATE_ENTER_NAME:
-            case GAME_STATE_SCOREBOARD:
-                PlayMusicStream(game->nameEntryMusic);
-                break;
-        }
-        
-        previousState = game->currentState;
-    }
+// Faixa que deve estar tocando no estado atual. Pausa usa a mesma faixa do
+// jogo com volume reduzido, então pausar não reinicia nenhum stream.
+static void SelectStateMusic(Game *game) {
+    Music *gameplayMusic = (game->bossActive && game->boss.active) ? &game->bossMusic : &game->backgroundMusic;
+    float gameplayVolume = (gameplayMusic == &game->bossMusic) ? MUSIC_VOLUME_BOSS : MUSIC_VOLUME_GAMEPLAY;
     
-    // Atualizar a música do estado atual
     switch (game->currentState) {
         case GAME_STATE_MAIN_MENU:
-            UpdateMusicStream(game->menuMusic);
+        case GAME_STATE_GAME_OVER:  // Usar a música do menu em vez da música de game over
+            PlayDirectedMusic(&game->musicDirector, &game->menuMusic, MUSIC_VOLUME_MENU);
             break;
             
         case GAME_STATE_TUTORIAL:
-            UpdateMusicStream(game->tutorialMusic);
+            PlayDirectedMusic(&game->musicDirector, &game->tutorialMusic, MUSIC_VOLUME_MENU);
             break;
             
         case GAME_STATE_PLAYING:
-            // Se o boss estiver ativo, atualizar a música do boss
-            if (game->bossActive && game->boss.active) {
-                UpdateMusicStream(game->bossMusic);
-            } else {
-                UpdateMusicStream(game->backgroundMusic);
-            }
+            PlayDirectedMusic(&game->musicDirector, gameplayMusic, gameplayVolume);
             break;
             
         case GAME_STATE_PAUSED:
-            UpdateMusicStream(game->pauseMusic);
-            break;
-            
-        case GAME_STATE_GAME_OVER:
-            // Usar a música do menu em vez da música de game over
-            UpdateMusicStream(game->menuMusic);  // MODIFICADO: era game->gameOverMusic
+            PlayDirectedMusic(&game->musicDirector, gameplayMusic, MUSIC_VOLUME_PAUSE);
             break;
             
         case GAME_STATE_ENTER_NAME:
         case GAME_STATE_SCOREBOARD:
-            UpdateMusicStream(game->nameEntryMusic);
+            PlayDirectedMusic(&game->musicDirector, &game->nameEntryMusic, MUSIC_VOLUME_NAME_ENTRY);
             break;
     }
+}
+
+void UpdateGame(Game *game, float deltaTime) {
+    GameState previousState = game->currentState;
+    
+    // Escolher a faixa do estado (crossfade só quando ela muda) e
+    // atualizar apenas os streams audíveis
+    SelectStateMusic(game);
+    UpdateMusicDirector(&game->musicDirector, deltaTime);
     
     // Resto do código existente do switch case
     switch (game->currentState) {
@@ -971,14 +828,6 @@ void UpdateGame(Game *game, float deltaTime) {
             
             ShowCursor();
             
-            // Verificar se a música está tocando
-            if (!IsMusicStreamPlaying(game->menuMusic)) {
-                PlayMusicStream(game->menuMusic);
-                printf("Reiniciando música do menu\n");
-            }
-            
-            UpdateMusicStream(game->menuMusic);
-            
             if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON) || 
                 IsMouseButtonPressed(MOUSE_RIGHT_BUTTON) || 
                 IsMouseButtonPressed(MOUSE_MIDDLE_BUTTON) || 
@@ -1007,6 +856,7 @@ void UpdateGame(Game *game, float deltaTime) {
             
             
             game->gameTime += deltaTime;
+            RecordTelemetryFrame(game->gameTime, deltaTime, game->enemies.count);
             
             
             HideCursor();
@@ -1014,6 +864,8 @@ void UpdateGame(Game *game, float deltaTime) {
             
             if (IsKeyPressed(KEY_P)) {
                 game->currentState = GAME_STATE_PAUSED;
+                // O quadro congelado da pausa é capturado de novo no próximo desenho
+                InvalidateScreenCache(SCREEN_CACHE_PAUSE);
                 break; 
             }
             
@@ -1028,8 +880,7 @@ void UpdateGame(Game *game, float deltaTime) {
             
             UpdateBullets(&game->enemyBullets, deltaTime, SCREEN_WIDTH, SCREEN_HEIGHT);
             HandleCollisions(game);
-            SpawnEnemy(game);
-            UpdateDifficulty(game, deltaTime);
+            SpawnEnemy(game, deltaTime);
 
             
             UpdatePowerups(&game->powerups, deltaTime);
@@ -1037,12 +888,13 @@ void UpdateGame(Game *game, float deltaTime) {
             
             PowerupType collectedType;
             if (CheckPowerupCollision(&game->powerups, game->player.position, game->player.radius, &collectedType)) {
+                RecordTelemetryEvent(TELEMETRY_PICKUP, collectedType, 0.0f, 0);
+                
                 // Tocar som específico para cada tipo de powerup
                 switch (collectedType) {
                     case POWERUP_DAMAGE:
                         PlayGameSound(game->powerupDamageSound);
-                        increasedDamage = true;  // Ativar dano aumentado
-                        game->increasedDamage = true;  // Manter sincronizado
+                        game->increasedDamage = true;  // Ativar dano aumentado
                         
                         // Mostrar mensagem na tela
                         ShowScreenText("DANO AUMENTADO!", 
@@ -1052,6 +904,7 @@ void UpdateGame(Game *game, float deltaTime) {
                         // Reduzir uma vida como custo (se tiver mais que 1)
                         if (game->player.lives > 1) {
                             game->player.lives--;
+                            RecordTelemetryEvent(TELEMETRY_DAMAGE, TELEMETRY_DAMAGE_POWERUP_COST, 1.0f, game->player.lives);
                         }
                         break;
                         
@@ -1126,6 +979,7 @@ void UpdateGame(Game *game, float deltaTime) {
             
             if (IsKeyPressed(KEY_M)) {
                 game->currentState = GAME_STATE_MAIN_MENU;
+                endTelemetryRun(game, TELEMETRY_RUN_END_ABANDONED);
             }
             
             
@@ -1146,6 +1000,8 @@ void UpdateGame(Game *game, float deltaTime) {
             } else if (IsKeyPressed(KEY_S)) {
                 
                 game->currentState = GAME_STATE_ENTER_NAME;
+                // O resumo em cache é o da partida anterior: refazer no próximo desenho
+                InvalidateScreenCache(SCREEN_CACHE_NAME_ENTRY);
                 memset(game->playerName, 0, MAX_NAME_LENGTH);
                 game->nameLength = 0;
             } else if (IsKeyPressed(KEY_M)) {
@@ -1180,7 +1036,6 @@ void UpdateGame(Game *game, float deltaTime) {
             if (IsKeyPressed(KEY_ENTER) && game->nameLength > 0) {
                 
                 AddScore(game->playerName, game->score, game->enemiesKilled, game->gameTime);
-                SaveScoreboard(); 
                 
                 
                 game->currentState = GAME_STATE_SCOREBOARD;
@@ -1200,9 +1055,21 @@ void UpdateGame(Game *game, float deltaTime) {
                 game->currentState = GAME_STATE_MAIN_MENU;
             }
             
+            // Trocar o critério só escolhe outro índice já ordenado
+            if (IsKeyPressed(KEY_RIGHT)) {
+                game->currentSortType = (game->currentSortType + 1) % SORT_TYPE_COUNT;
+            } else if (IsKeyPressed(KEY_LEFT)) {
+                game->currentSortType = (game->currentSortType + SORT_TYPE_COUNT - 1) % SORT_TYPE_COUNT;
+            }
+            SetScoreboardView(game->currentSortType);
             
             break;
     }
+    
+    // A partida termina em qualquer um dos pontos de morte do jogador
+    if (previousState == GAME_STATE_PLAYING && game->currentState == GAME_STATE_GAME_OVER) {
+        endTelemetryRun(game, TELEMETRY_RUN_END_GAME_OVER);
+    }
 
     
     UpdateScreenTexts(deltaTime);
@@ -1223,13 +1090,10 @@ void DrawGame(Game *game) {
             
         case GAME_STATE_PLAYING:
             
-            DrawGameplay(&game->player, &game->enemies, game->bullets, 
-                         game->enemyBullets, game->powerups, game->score);
-            
-            
-            if (game->bossActive && game->boss.active) {
-                DrawBoss(&game->boss);
-            }
+            // O boss é desenhado junto da área de jogo (mesmo recorte e pixelação)
+            DrawGameplay(&game->player, &game->enemies, &game->bullets, 
+                         &game->enemyBullets, &game->powerups, 
+                         game->bossActive ? &game->boss : NULL, game->score);
             
             
             if (game->showBossMessage) {
@@ -1251,13 +1115,23 @@ void DrawGame(Game *game) {
             }
             
             if (game->hasBossReward) {
-                if (game->activeBossReward == BOSS_REWARD_RAPID_FIRE) {
-                    const char* timeText = TextFormat("DISPARO RÁPIDO: %.1f", game->bossRewardTimer);
-                    DrawText(timeText, 10, GetScreenHeight() - 30, 20, RED);
-                } else {
-                    const char* timeText = TextFormat("PODER ESPECIAL: %.1f", game->bossRewardTimer);
-                    DrawText(timeText, 10, GetScreenHeight() - 30, 20, WHITE);
+                // O texto só muda a cada décimo de segundo; fora isso, reaproveitar
+                static int formattedTenths = -1;
+                static BossRewardType formattedReward = BOSS_REWARD_NONE;
+                static char timeText[48];
+                int tenths = (int)(game->bossRewardTimer * 10.0f + 0.5f);
+                if (tenths < 0) tenths = 0;
+                
+                if (tenths != formattedTenths || game->activeBossReward != formattedReward) {
+                    snprintf(timeText, sizeof(timeText), "%s: %d.%d",
+                             game->activeBossReward == BOSS_REWARD_RAPID_FIRE ? "DISPARO RÁPIDO" : "PODER ESPECIAL",
+                             tenths / 10, tenths % 10);
+                    formattedTenths = tenths;
+                    formattedReward = game->activeBossReward;
                 }
+                
+                Color timeColor = (game->activeBossReward == BOSS_REWARD_RAPID_FIRE) ? RED : WHITE;
+                DrawCachedText(timeText, 10, GetScreenHeight() - 30, 20, timeColor);
             }
             
             DrawScreenTexts();
@@ -1265,8 +1139,13 @@ void DrawGame(Game *game) {
             
         case GAME_STATE_PAUSED:
             
-            DrawGameplay(&game->player, &game->enemies, game->bullets, 
-                         game->enemyBullets, game->powerups, game->score);
+            // O jogo está parado: a cena é desenhada uma vez e reaproveitada
+            if (BeginScreenCache(SCREEN_CACHE_PAUSE, 0)) {
+                DrawGameplay(&game->player, &game->enemies, &game->bullets, 
+                             &game->enemyBullets, &game->powerups, NULL, game->score);
+                EndScreenCache();
+            }
+            DrawScreenCache(SCREEN_CACHE_PAUSE, 1.0f);
             
             
             DrawPauseMenu();
@@ -8,6 +8,7 @@
 #include "powerup.h"
 #include "boss.h"
 #include "scoreboard.h" 
+#include "wave_scheduler.h"
 
 #define MAX_NAME_LENGTH 50  
 #define SHOOT_COOLDOWN 0.22f  // Tempo em segundos entre disparos
@@ -28,20 +29,19 @@ typedef enum {
     BOSS_REWARD_RAPID_FIRE,   // Disparo rápido
     BOSS_REWARD_QUICANTE,     // Tiros que quicam uma vez (alterado de PENETRATION)
     BOSS_REWARD_TRIPLE_SHOT,  // Tiro triplo
-    BOSS_REWARD_HOMING        // Tiros teleguiados
+    BOSS_REWARD_HOMING,       // Tiros teleguiados
+    BOSS_REWARD_PENETRATION   // Tiros que atravessam inimigos
 } BossRewardType;
 
 typedef struct Game {
     Player player;
     EnemyList enemies;
-    Bullet *bullets;
-    Bullet *enemyBullets;  
+    BulletList bullets;
+    BulletList enemyBullets;
     long score; 
     GameState currentState;
 
-    float enemySpawnTimer;
-    float enemySpawnInterval; 
-    float difficultyTimer;    
+    WaveScheduler waves;     // fila dos próximos spawns e curva de dificuldade
     float shootCooldown;  
 
     
@@ -59,8 +59,6 @@ typedef struct Game {
     
     Music menuMusic;         // Música do menu principal
     Music tutorialMusic;     // Música da tela de tutorial
-    Music pauseMusic;        // Música da tela de pausa
-    Music gameOverMusic;     // Música de game over
     Music nameEntryMusic;    // Música da tela de entrada de nome
     Sound menuClickSound;    // Som ao clicar em opções
     Sound powerupDamageSound;  // Som do powerup vermelho (dano)
@@ -73,7 +71,7 @@ typedef struct Game {
     int nextPowerupAt;  
 
     
-    Powerup *powerups;
+    PowerupStore powerups;
 
     
     bool increasedDamage;
@@ -95,9 +93,8 @@ typedef struct Game {
     bool showGameSummary;    
     SortType currentSortType; 
 
-    // Para fade da música do boss
-    bool bossMusicFadeIn;
-    float bossMusicFadeTimer;
+    // Crossfade entre as músicas de cada estado
+    MusicDirector musicDirector;
 
     // Novos campos para gerenciar a recompensa do boss
     BossRewardType activeBossReward;
@@ -111,7 +108,7 @@ void InitGame(Game *game);
 void ResetGame(Game *game);
 void UpdateGame(Game *game, float deltaTime);
 void DrawGame(Game *game);  
-
-extern bool increasedDamage;  // Declaração para uso em outros arquivos
+// Balas do jogador x inimigos/boss e do jogador x inimigos/balas inimigas
+void HandleCollisions(Game *game);
 
 #endif
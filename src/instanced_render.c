@@ -0,0 +1,343 @@
+#include "instanced_render.h"
+#include "raymath.h"
+#include "rlgl.h"
+#include <stdio.h>
+
+
+// Dados por instância enviados à GPU uma vez por lote
+typedef struct {
+    float x, y, radius, extent;       // centro, raio e meia largura do quad
+    float shape, pulse, angle, param; // forma, pulso, direção/rotação, parâmetro da forma
+    float vx, vy, detail, unused;     // velocidade (rastros e exaustão) e nível de detalhe
+    float r, g, b, a;
+} EntityInstance;
+
+
+// Cada instância é um quad que cobre a entidade; o fragment shader recorta a forma
+// na mesma grade de 3px usada por DrawPixelCircle, então o visual não muda.
+static const char *instanceVertexShader =
+    "#version 330\n"
+    "layout(location = 0) in vec2 vertexCorner;\n"
+    "layout(location = 1) in vec4 instanceShape;\n"
+    "layout(location = 2) in vec4 instanceParams;\n"
+    "layout(location = 3) in vec4 instanceMotion;\n"
+    "layout(location = 4) in vec4 instanceColor;\n"
+    "uniform mat4 mvp;\n"
+    "out vec2 fragWorld;\n"
+    "flat out vec4 fragShape;\n"
+    "flat out vec4 fragParams;\n"
+    "flat out vec4 fragMotion;\n"
+    "flat out vec4 fragColor;\n"
+    "void main() {\n"
+    "    vec2 world = instanceShape.xy + vertexCorner*instanceShape.w;\n"
+    "    fragWorld = world;\n"
+    "    fragShape = instanceShape;\n"
+    "    fragParams = instanceParams;\n"
+    "    fragMotion = instanceMotion;\n"
+    "    fragColor = instanceColor;\n"
+    "    gl_Position = mvp*vec4(world, 0.0, 1.0);\n"
+    "}\n";
+
+static const char *instanceFragmentShader =
+    "#version 330\n"
+    "in vec2 fragWorld;\n"
+    "flat in vec4 fragShape;\n"
+    "flat in vec4 fragParams;\n"
+    "flat in vec4 fragMotion;\n"
+    "flat in vec4 fragColor;\n"
+    "uniform float time;\n"
+    "out vec4 finalColor;\n"
+    "const float PIXEL = 3.0;\n"
+    "const float TAU = 6.28318530718;\n"
+    "const vec4 INK = vec4(0.0, 0.0, 0.0, 1.0);\n"
+    "const vec4 MID_GRAY = vec4(130.0, 130.0, 130.0, 255.0)/255.0;\n"
+    "const vec4 LIGHT_GRAY = vec4(200.0, 200.0, 200.0, 255.0)/255.0;\n"
+    "vec4 result = vec4(0.0);\n"
+    // Compõe as camadas na mesma ordem em que a versão da CPU desenha
+    "void paint(bool inside, vec4 color) {\n"
+    "    if (!inside) return;\n"
+    "    float a = color.a + result.a*(1.0 - color.a);\n"
+    "    if (a <= 0.0) return;\n"
+    "    result.rgb = (color.rgb*color.a + result.rgb*result.a*(1.0 - color.a))/a;\n"
+    "    result.a = a;\n"
+    "}\n"
+    "bool disc(vec2 p, vec2 c, float r) { return distance(p, c) <= r; }\n"
+    "bool segment(vec2 p, vec2 a, vec2 b, float halfWidth) {\n"
+    "    vec2 ab = b - a;\n"
+    "    float t = clamp(dot(p - a, ab)/max(dot(ab, ab), 0.0001), 0.0, 1.0);\n"
+    "    return distance(p, a + ab*t) <= halfWidth;\n"
+    "}\n"
+    // Raio mais próximo de p em uma roda de 'count' raios girada de 'rotation'
+    "float spokeIndex(vec2 p, float rotation, float count) {\n"
+    "    return floor((atan(p.y, p.x) - rotation)/(TAU/count) + 0.5);\n"
+    "}\n"
+    "vec2 spokeDir(float k, float rotation, float count) {\n"
+    "    float a = rotation + k*TAU/count;\n"
+    "    return vec2(cos(a), sin(a));\n"
+    "}\n"
+    "vec4 faded(vec4 c, float alpha) { return vec4(c.rgb, c.a*alpha); }\n"
+    "void main() {\n"
+    "    float r = fragShape.z;\n"
+    "    int shape = int(fragParams.x + 0.5);\n"
+    "    float pulse = fragParams.y;\n"
+    "    vec2 dir = vec2(cos(fragParams.z), sin(fragParams.z));\n"
+    "    vec2 perp = vec2(-dir.y, dir.x);\n"
+    "    float param = fragParams.w;\n"
+    "    vec2 velocity = fragMotion.xy;\n"
+    // Mesmos cortes do desenho na CPU: 0 cheio, 1 reduzido, 2 só a silhueta
+    "    int detail = int(fragMotion.z + 0.5);\n"
+    "    bool full = detail == 0;\n"
+    "    bool minimal = detail >= 2;\n"
+    "    vec4 color = fragColor;\n"
+    "    vec2 p = fragWorld - fragShape.xy;\n"
+    "    if (shape != 6) p = floor(fragWorld/PIXEL)*PIXEL + PIXEL*0.5 - fragShape.xy;\n"
+    "    if (shape == 0) {\n"
+    "        float s = r*1.8*pulse;\n"
+    "        float d = max(abs(p.x), abs(p.y));\n"
+    "        paint(d <= s*0.5, color);\n"
+    "        paint(d <= s*0.35, INK);\n"
+    "        if (!minimal) paint(d <= s*0.2, color);\n"
+    "        if (full) paint(disc(p, vec2(0.0), r*0.15), color);\n"
+    "    } else if (shape == 1) {\n"
+    "        paint(disc(p, vec2(0.0), r*pulse), color);\n"
+    "        paint(disc(p, vec2(0.0), r*0.7*pulse), INK);\n"
+    "        if (!minimal) {\n"
+    "            paint(disc(p, dir*r*0.9, r*0.4), color);\n"
+    "            paint(disc(p, perp*r*0.8, r*0.3), color);\n"
+    "            paint(disc(p, -perp*r*0.8, r*0.3), color);\n"
+    "        }\n"
+    "        if (!minimal && length(velocity) > 50.0) {\n"
+    "            float exhaustPulse = 0.7 + sin(time*10.0)*0.3;\n"
+    "            vec2 exhaust = -dir*r*0.9;\n"
+    "            paint(disc(p, exhaust, r*0.5*exhaustPulse), faded(color, 0.7));\n"
+    "            if (full) {\n"
+    "                paint(disc(p, exhaust - dir*r*0.3, r*0.3*exhaustPulse), faded(color, 0.5));\n"
+    "                paint(disc(p, exhaust - dir*r*0.6, r*0.2*exhaustPulse), faded(color, 0.3));\n"
+    "            }\n"
+    "        }\n"
+    "    } else if (shape == 2) {\n"
+    "        paint(disc(p, vec2(0.0), r*1.3*pulse), color);\n"
+    "        if (minimal) {\n"
+    "            paint(disc(p, vec2(0.0), r*0.7), MID_GRAY);\n"
+    "        } else {\n"
+    "            paint(disc(p, vec2(0.0), r*0.9*pulse), INK);\n"
+    "            paint(disc(p, vec2(0.0), r*0.7*pulse), MID_GRAY);\n"
+    "            float towerRotation = time*0.5;\n"
+    "            float towers = full ? 8.0 : 4.0;\n"
+    "            float k = spokeIndex(p, towerRotation, towers);\n"
+    "            paint(disc(p, spokeDir(k, towerRotation, towers)*r*0.6*pulse, r*0.15), color);\n"
+    // Canhão e esteiras com os passos da CPU (0.2 ou 0.5, pontas incluídas); o
+    // contador é inteiro para o arredondamento da GPU não perder o último disco
+    "            float segmentStep = full ? 0.2 : 0.5;\n"
+    "            int steps = full ? 5 : 2;\n"
+    "            for (int i = 0; i <= steps; i++) {\n"
+    "                float t = float(i)*segmentStep;\n"
+    "                paint(disc(p, dir*r*1.5*t, r*0.25*(1.0 - t*0.3)), color);\n"
+    "            }\n"
+    "            paint(disc(p, dir*r*1.5, r*0.15), LIGHT_GRAY);\n"
+    "            for (int i = 0; i <= steps; i++) {\n"
+    "                float t = -0.5 + float(i)*segmentStep;\n"
+    "                paint(disc(p, dir*r*t - perp*r*0.8, r*0.12), color);\n"
+    "                paint(disc(p, dir*r*t + perp*r*0.8, r*0.12), color);\n"
+    "            }\n"
+    "            paint(disc(p, vec2(0.0), r*0.2), LIGHT_GRAY);\n"
+    "        }\n"
+    "    } else if (shape == 3) {\n"
+    "        paint(disc(p, vec2(0.0), r*0.7*pulse), color);\n"
+    "        paint(disc(p, vec2(0.0), r*0.5*pulse), INK);\n"
+    "        if (!minimal) {\n"
+    "            float rotation = time*3.0;\n"
+    "            float spikes = full ? 8.0 : 4.0;\n"
+    "            float k = spokeIndex(p, rotation, spikes);\n"
+    "            float spikePulse = 0.8 + sin(time*5.0 + (full ? mod(k, 8.0) : 0.0))*0.2;\n"
+    "            vec2 spike = spokeDir(k, rotation, spikes);\n"
+    "            paint(segment(p, spike*r*0.5, spike*r*1.3*spikePulse, PIXEL*0.5), color);\n"
+    "            paint(disc(p, spike*r*1.3*spikePulse, r*0.15), color);\n"
+    "            float corePulse = 0.7 + sin(time*8.0)*0.3;\n"
+    "            paint(disc(p, vec2(0.0), r*0.3*corePulse), color);\n"
+    "            if (corePulse > 0.9) paint(disc(p, vec2(0.0), r*pulse*1.5), faded(color, corePulse*0.2));\n"
+    "        }\n"
+    "    } else if (shape == 4) {\n"
+    "        paint(disc(p, vec2(0.0), r*0.8*pulse), color);\n"
+    "        paint(disc(p, vec2(0.0), r*0.65*pulse), INK);\n"
+    "        if (!minimal) {\n"
+    "            paint(disc(p, vec2(0.0), r*0.5*pulse), color);\n"
+    "            float rotation = time*1.5 + param*3.0;\n"
+    "            float cannons = full ? 5.0 : 3.0;\n"
+    "            vec2 cannon = spokeDir(spokeIndex(p, rotation, cannons), rotation, cannons);\n"
+    "            paint(segment(p, cannon*r*0.5, cannon*r*1.1*pulse, PIXEL*0.5), color);\n"
+    "            if (param > 0.5) {\n"
+    "                float charge = (param - 0.5)/0.5;\n"
+    "                paint(disc(p, cannon*r*1.1*pulse, r*0.18*charge), vec4(1.0, 1.0, 1.0, 0.4 + charge*0.6));\n"
+    "            }\n"
+    "            float corePulse = 0.7;\n"
+    "            if (param > 0.3) corePulse = 0.7 + sin(time*8.0)*0.3*((param - 0.3)/0.7);\n"
+    "            paint(disc(p, vec2(0.0), r*0.35*corePulse), faded(color, 0.7 + corePulse*0.3));\n"
+    "            if (param > 0.7) {\n"
+    "                float charge = (param - 0.7)/0.3;\n"
+    "                paint(disc(p, vec2(0.0), r*pulse*(1.0 + charge*0.2)), faded(color, 0.2*charge));\n"
+    "            }\n"
+    "        }\n"
+    "    } else if (shape == 5) {\n"
+    "        paint(disc(p, vec2(0.0), r), color);\n"
+    "        if (!minimal) paint(disc(p, -velocity*0.02, r*0.6), vec4(1.0, 1.0, 1.0, 120.0/255.0));\n"
+    "    } else {\n"
+    "        for (int i = 0; i < 4; i++) {\n"
+    "            paint(segment(p, spokeDir(float(i), fragParams.z, 4.0)*r*1.26,\n"
+    "                          spokeDir(float(i + 1), fragParams.z, 4.0)*r*1.26, r*0.2), color);\n"
+    "        }\n"
+    "        paint(disc(p, vec2(0.0), r*0.5), color);\n"
+    "        if (!minimal) paint(disc(p, -velocity*0.03, r*0.4), faded(color, 0.6));\n"
+    "        if (full) paint(disc(p, -velocity*0.06, r*0.3), faded(color, 0.3));\n"
+    "    }\n"
+    "    if (result.a <= 0.0) discard;\n"
+    "    finalColor = result;\n"
+    "}\n";
+
+
+static Shader instanceShader = { 0 };
+static int mvpLocation = -1;
+static int timeLocation = -1;
+
+static unsigned int instanceVao = 0;
+static unsigned int quadVbo = 0;
+static unsigned int instanceVbo = 0;
+
+static bool rendererReady = false;
+static bool instancingEnabled = false;
+
+static EntityInstance instances[MAX_ENTITY_INSTANCES];
+static int instanceCount = 0;
+
+
+// Meia largura do quad: o suficiente para cobrir canhões, espinhos e rastros
+static float shapeExtent(EntityShape shape, float radius, float speed) {
+    switch (shape) {
+        case ENTITY_SHAPE_NORMAL:        return radius * 1.1f;
+        case ENTITY_SHAPE_SPEEDER:       return radius * 1.8f;
+        case ENTITY_SHAPE_TANK:          return radius * 1.7f;
+        case ENTITY_SHAPE_EXPLODER:      return radius * 1.7f;
+        case ENTITY_SHAPE_SHOOTER:       return radius * 1.4f;
+        case ENTITY_SHAPE_PLAYER_BULLET: return radius + speed * 0.02f;
+        case ENTITY_SHAPE_ENEMY_BULLET:
+        default:                         return radius * 1.5f + speed * 0.06f;
+    }
+}
+
+
+bool InitInstancedRenderer(void) {
+    instanceShader = LoadShaderFromMemory(instanceVertexShader, instanceFragmentShader);
+    if (instanceShader.id == 0 || instanceShader.id == rlGetShaderIdDefault()) {
+        printf("AVISO: shader de instâncias indisponível, usando o desenho na CPU\n");
+        return false;
+    }
+    
+    mvpLocation = GetShaderLocation(instanceShader, "mvp");
+    timeLocation = GetShaderLocation(instanceShader, "time");
+    
+    // Dois triângulos cobrindo [-1, 1]; o vertex shader escala pela extensão
+    static const float corners[12] = {
+        -1.0f, -1.0f,   1.0f, -1.0f,   1.0f, 1.0f,
+        -1.0f, -1.0f,   1.0f,  1.0f,  -1.0f, 1.0f
+    };
+    
+    instanceVao = rlLoadVertexArray();
+    rlEnableVertexArray(instanceVao);
+    
+    quadVbo = rlLoadVertexBuffer(corners, sizeof(corners), false);
+    rlSetVertexAttribute(0, 2, RL_FLOAT, false, 0, 0);
+    rlEnableVertexAttribute(0);
+    
+    instanceVbo = rlLoadVertexBuffer(NULL, sizeof(instances), true);
+    const int stride = sizeof(EntityInstance);
+    rlSetVertexAttribute(1, 4, RL_FLOAT, false, stride, (void *)0);
+    rlSetVertexAttribute(2, 4, RL_FLOAT, false, stride, (void *)(4 * sizeof(float)));
+    rlSetVertexAttribute(3, 4, RL_FLOAT, false, stride, (void *)(8 * sizeof(float)));
+    rlSetVertexAttribute(4, 4, RL_FLOAT, false, stride, (void *)(12 * sizeof(float)));
+    for (int i = 1; i <= 4; i++) {
+        rlSetVertexAttributeDivisor(i, 1);
+        rlEnableVertexAttribute(i);
+    }
+    
+    rlDisableVertexArray();
+    
+    rendererReady = true;
+    instancingEnabled = true;
+    return true;
+}
+
+
+void UnloadInstancedRenderer(void) {
+    if (!rendererReady) return;
+    
+    rlUnloadVertexBuffer(instanceVbo);
+    rlUnloadVertexBuffer(quadVbo);
+    rlUnloadVertexArray(instanceVao);
+    UnloadShader(instanceShader);
+    
+    rendererReady = false;
+    instancingEnabled = false;
+    instanceCount = 0;
+}
+
+
+void SetInstancedRendering(bool enabled) {
+    instancingEnabled = enabled && rendererReady;
+}
+
+
+bool IsInstancedRenderingEnabled(void) {
+    return instancingEnabled;
+}
+
+
+void QueueEntityInstance(EntityShape shape, Vector2 position, Vector2 velocity, float radius,
+                         float pulse, float angle, float param, DetailLevel detail, Color color) {
+    if (instanceCount == MAX_ENTITY_INSTANCES) {
+        FlushEntityInstances();
+    }
+    
+    EntityInstance *instance = &instances[instanceCount++];
+    instance->x = position.x;
+    instance->y = position.y;
+    instance->radius = radius;
+    instance->extent = shapeExtent(shape, radius, Vector2Length(velocity)) + 3.0f;
+    instance->shape = (float)shape;
+    instance->pulse = pulse;
+    instance->angle = angle;
+    instance->param = param;
+    instance->vx = velocity.x;
+    instance->vy = velocity.y;
+    instance->detail = (float)detail;
+    instance->unused = 0.0f;
+    instance->r = color.r / 255.0f;
+    instance->g = color.g / 255.0f;
+    instance->b = color.b / 255.0f;
+    instance->a = color.a / 255.0f;
+}
+
+
+void FlushEntityInstances(void) {
+    if (instanceCount == 0 || !rendererReady) {
+        instanceCount = 0;
+        return;
+    }
+    
+    // O que já está no lote do raylib precisa ser desenhado antes (ordem e scissor)
+    rlDrawRenderBatchActive();
+    
+    Matrix mvp = MatrixMultiply(rlGetMatrixModelview(), rlGetMatrixProjection());
+    float time = (float)GetTime();
+    
+    rlEnableShader(instanceShader.id);
+    rlSetUniformMatrix(mvpLocation, mvp);
+    rlSetUniform(timeLocation, &time, RL_SHADER_UNIFORM_FLOAT, 1);
+    
+    rlEnableVertexArray(instanceVao);
+    rlUpdateVertexBuffer(instanceVbo, instances, instanceCount * sizeof(EntityInstance), 0);
+    rlDrawVertexArrayInstanced(0, 6, instanceCount);
+    rlDisableVertexArray();
+    
+    rlDisableShader();
+    instanceCount = 0;
+}
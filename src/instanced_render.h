@@ -0,0 +1,39 @@
+#ifndef INSTANCED_RENDER_H
+#define INSTANCED_RENDER_H
+
+#include "raylib.h"
+#include "detail_level.h"
+#include <stdbool.h>
+
+#define MAX_ENTITY_INSTANCES 16384   // por envio; filas maiores são desenhadas em partes
+
+// Formas desenhadas pelo shader de instâncias (uma por classe de entidade)
+typedef enum {
+    ENTITY_SHAPE_NORMAL = 0,
+    ENTITY_SHAPE_SPEEDER,
+    ENTITY_SHAPE_TANK,
+    ENTITY_SHAPE_EXPLODER,
+    ENTITY_SHAPE_SHOOTER,
+    ENTITY_SHAPE_PLAYER_BULLET,
+    ENTITY_SHAPE_ENEMY_BULLET
+} EntityShape;
+
+// Compila o shader e cria os buffers. Se falhar, o modo instanciado fica
+// indisponível e o jogo continua com o desenho por primitivas na CPU.
+bool InitInstancedRenderer(void);
+void UnloadInstancedRenderer(void);
+
+// Alternância em tempo de execução para comparar os dois caminhos no profiler
+void SetInstancedRendering(bool enabled);
+bool IsInstancedRenderingEnabled(void);
+
+// Acumula uma instância. angle é a direção (speeder, tank) ou a rotação (bala inimiga);
+// param é o shootTimer do atirador; a velocidade alimenta rastros e exaustão.
+// O shader corta as mesmas camadas que o desenho na CPU corta em cada nível de detalhe.
+void QueueEntityInstance(EntityShape shape, Vector2 position, Vector2 velocity, float radius,
+                         float pulse, float angle, float param, DetailLevel detail, Color color);
+
+// Envia tudo o que foi acumulado em uma única chamada instanciada
+void FlushEntityInstances(void);
+
+#endif
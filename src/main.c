@@ -2,12 +2,19 @@
 #include "game.h"   
 #include "render.h" 
 #include "utils.h"  
+#include "instanced_render.h"
+#include "pixel_post.h"
+#include "screen_cache.h"
+#include "frame_pacing.h"
+#include "telemetry.h"
 
 
 int main(void) {
     
     InitWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "M.A.G. O inimigo agora é outro"); 
-    SetTargetFPS(TARGET_FPS);
+    InitFramePacing();
+    InitTelemetry();
+    InitInstancedRenderer();
     
 
     Game game;
@@ -15,12 +22,39 @@ int main(void) {
 
     
     while (!WindowShouldClose()) {
+        // Menus, pausa e ranking podem baixar a taxa quando ninguém está jogando
+        bool staticScreen = game.currentState != GAME_STATE_PLAYING;
+        BeginFramePacing(staticScreen);
+        
         float deltaTime = GetFrameTime();
 
         
         if (IsKeyPressed(KEY_KP_MULTIPLY)) {
             AppToggleFullscreen();
         }
+        
+        // F3 alterna entre o desenho instanciado na GPU e as primitivas na CPU
+        if (IsKeyPressed(KEY_F3)) {
+            SetInstancedRendering(!IsInstancedRenderingEnabled());
+        }
+        
+        // F4 alterna a pixelação por render target e a grade montada na CPU
+        if (IsKeyPressed(KEY_F4)) {
+            SetPixelPostEnabled(!IsPixelPostEnabled());
+        }
+        
+        // F5 troca o ritmo da partida (60 FPS, VSync, sem limite); F6 mostra as medidas
+        if (IsKeyPressed(KEY_F5)) {
+            SetFramePacingMode((GetFramePacingMode() + 1) % FRAME_PACING_MODE_COUNT);
+        }
+        if (IsKeyPressed(KEY_F6)) {
+            SetFramePacingOverlay(!IsFramePacingOverlayVisible());
+        }
+        
+        // F7 liga/desliga o afastamento entre inimigos (comparar com a multidão sobreposta)
+        if (IsKeyPressed(KEY_F7)) {
+            SetEnemySeparation(!IsEnemySeparationEnabled());
+        }
 
         
         UpdateGame(&game, deltaTime);
@@ -31,8 +65,14 @@ int main(void) {
 
             
             DrawGame(&game);
+            DrawFramePacingOverlay();
             
         EndDrawing();
+        
+        // Quadro ocioso: esperar acordando na primeira entrada, sem deixar a música secar
+        while (FramePacingShouldWait()) {
+            UpdateMusicDirector(&game.musicDirector, 0.0f);
+        }
     }
 
     
@@ -42,9 +82,15 @@ int main(void) {
                    game.enemyExploderDeathSound, game.enemyShooterDeathSound, 
                    game.dashSound, // Adicione esta linha para o som do dash
                    game.backgroundMusic, game.menuMusic, game.tutorialMusic,
-                   game.pauseMusic, game.gameOverMusic, game.nameEntryMusic,
+                   game.nameEntryMusic,
                    game.bossMusic,
                    game.menuClickSound, game.powerupDamageSound, game.powerupHealSound, game.powerupShieldSound);
+    // Esperar a gravação do placar terminar antes de sair
+    ShutdownScoreboard();
+    ShutdownTelemetry();
+    UnloadInstancedRenderer();
+    UnloadPixelPost();
+    UnloadScreenCaches();
     CloseAudioDevice(); 
     CloseWindow();      
 
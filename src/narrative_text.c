@@ -1,4 +1,5 @@
 #include "narrative_text.h"
+#include "text_cache.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -226,21 +227,17 @@ void DrawScreenTexts(void) {
             }
             
             
-            float textWidth = MeasureText(screenTexts[i].text, screenTexts[i].fontSize);
+            float textWidth = MeasureCachedText(screenTexts[i].text, screenTexts[i].fontSize);
             float textX = screenTexts[i].position.x - textWidth/2;
             
-            
-            DrawText(screenTexts[i].text, 
-                    textX + 2, 
-                    screenTexts[i].position.y + 2, 
-                    screenTexts[i].fontSize, 
-                    Fade(BLACK, textColor.a / 255.0f));
-                    
-            DrawText(screenTexts[i].text, 
-                    textX, 
-                    screenTexts[i].position.y, 
-                    screenTexts[i].fontSize, 
-                    textColor);
+            // Texto e sombra saem do mesmo layout em cache, em um único lote
+            DrawCachedTextShadow(screenTexts[i].text, 
+                                 textX, 
+                                 screenTexts[i].position.y, 
+                                 screenTexts[i].fontSize, 
+                                 textColor,
+                                 2, 
+                                 Fade(BLACK, textColor.a / 255.0f));
         }
     }
 }
\ No newline at end of file
@@ -0,0 +1,117 @@
+#include "pixel_post.h"
+#include "screen_cache.h"
+#include "raylib.h"
+#include <stdio.h>
+
+
+static RenderTexture2D sceneTarget = { 0 };
+static bool targetLoaded = false;
+static int targetScreenWidth = 0;
+static int targetScreenHeight = 0;
+
+static bool pixelPostEnabled = true;
+static bool sceneActive = false;
+static int sceneClipY = 0;
+
+
+// (Re)cria o alvo quando a janela muda de tamanho (ex.: tela cheia)
+static bool ensureSceneTarget(void) {
+    int screenWidth = GetScreenWidth();
+    int screenHeight = GetScreenHeight();
+    
+    if (targetLoaded && screenWidth == targetScreenWidth && screenHeight == targetScreenHeight) {
+        return true;
+    }
+    
+    if (targetLoaded) {
+        UnloadRenderTexture(sceneTarget);
+        targetLoaded = false;
+    }
+    
+    // Arredondar para cima para a última coluna/linha parcial também ter célula
+    int width = (screenWidth + PIXEL_POST_SCALE - 1) / PIXEL_POST_SCALE;
+    int height = (screenHeight + PIXEL_POST_SCALE - 1) / PIXEL_POST_SCALE;
+    
+    sceneTarget = LoadRenderTexture(width, height);
+    if (!IsRenderTextureReady(sceneTarget)) {
+        printf("AVISO: render target da pixelação indisponível, usando a grade na CPU\n");
+        pixelPostEnabled = false;
+        return false;
+    }
+    
+    SetTextureFilter(sceneTarget.texture, TEXTURE_FILTER_POINT);
+    targetLoaded = true;
+    targetScreenWidth = screenWidth;
+    targetScreenHeight = screenHeight;
+    return true;
+}
+
+
+void SetPixelPostEnabled(bool enabled) {
+    pixelPostEnabled = enabled;
+}
+
+
+bool IsPixelPostEnabled(void) {
+    return pixelPostEnabled;
+}
+
+
+bool IsPixelSceneActive(void) {
+    return sceneActive;
+}
+
+
+void BeginPixelatedScene(int clipY) {
+    sceneClipY = clipY;
+    
+    // Dentro da captura de uma camada de tela (pausa) não há como aninhar outro
+    // render target: a cena vai direto para a camada, só com o recorte
+    if (!pixelPostEnabled || IsScreenCacheCapturing() || !ensureSceneTarget()) {
+        BeginScissorMode(0, clipY, GetScreenWidth(), GetScreenHeight() - clipY);
+        return;
+    }
+    
+    BeginTextureMode(sceneTarget);
+    ClearBackground(BLACK);
+    
+    // Cada pixel do alvo corresponde a uma célula da grade da tela
+    Camera2D camera = { 0 };
+    camera.zoom = 1.0f / PIXEL_POST_SCALE;
+    BeginMode2D(camera);
+    
+    sceneActive = true;
+}
+
+
+void EndPixelatedScene(void) {
+    if (!sceneActive) {
+        EndScissorMode();
+        return;
+    }
+    
+    EndMode2D();
+    EndTextureMode();
+    sceneActive = false;
+    
+    // Ampliar com filtro ponto só na área de jogo. O alvo já foi composto sobre
+    // preto, então a cor é copiada como está (alfa pré-multiplicado sobre fundo preto).
+    float width = (float)sceneTarget.texture.width;
+    float height = (float)sceneTarget.texture.height;
+    Rectangle source = { 0.0f, 0.0f, width, -height };  // render targets ficam invertidos em Y
+    Rectangle dest = { 0.0f, 0.0f, width * PIXEL_POST_SCALE, height * PIXEL_POST_SCALE };
+    
+    BeginScissorMode(0, sceneClipY, GetScreenWidth(), GetScreenHeight() - sceneClipY);
+    BeginBlendMode(BLEND_ALPHA_PREMULTIPLY);
+    DrawTexturePro(sceneTarget.texture, source, dest, (Vector2){ 0.0f, 0.0f }, 0.0f, WHITE);
+    EndBlendMode();
+    EndScissorMode();
+}
+
+
+void UnloadPixelPost(void) {
+    if (targetLoaded) {
+        UnloadRenderTexture(sceneTarget);
+        targetLoaded = false;
+    }
+}
@@ -0,0 +1,24 @@
+#ifndef PIXEL_POST_H
+#define PIXEL_POST_H
+
+#include <stdbool.h>
+
+// Tamanho da célula do visual pixelado (mesmo de DrawPixelCircle/DrawPixelRect)
+#define PIXEL_POST_SCALE 3
+
+// Modo de pixelação por render target: a área de jogo é desenhada com primitivas
+// normais em um alvo de 1/PIXEL_POST_SCALE da resolução e ampliada com filtro
+// ponto (vizinho mais próximo). Enquanto a cena está aberta, as funções DrawPixel*
+// deixam de montar a grade na CPU e desenham a primitiva direta.
+void SetPixelPostEnabled(bool enabled);
+bool IsPixelPostEnabled(void);
+bool IsPixelSceneActive(void);
+
+// Abre/fecha a cena pixelada; clipY é onde a área de jogo começa (abaixo do HUD).
+// Com o modo desligado, apenas aplicam o scissor da área de jogo.
+void BeginPixelatedScene(int clipY);
+void EndPixelatedScene(void);
+
+void UnloadPixelPost(void);
+
+#endif
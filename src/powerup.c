@@ -1,104 +1,89 @@
 #include "powerup.h"
-#include <stdlib.h>
+#include <string.h>
 #include <math.h>  
 
 
-void InitPowerups(Powerup **powerups) {
-    *powerups = NULL;
+static void despawnSlots(PowerupStore *powerups, unsigned int slots) {
+    for (int i = 0; i < POWERUP_SLOTS; i++) {
+        unsigned int bit = 1u << i;
+        if (!(slots & bit) || !powerups->slots[i].active) continue;
+        
+        powerups->slots[i].active = false;
+        powerups->wheel[powerups->slots[i].bucket] &= ~bit;
+    }
 }
 
 
-void AddPowerup(Powerup **powerups, Vector2 position, PowerupType type) {
-    Powerup *newPowerup = (Powerup *)malloc(sizeof(Powerup));
-    if (newPowerup) {
-        newPowerup->position = position;
-        newPowerup->type = type;
-        newPowerup->radius = 15.0f;  
-        newPowerup->active = true;
-        newPowerup->lifeTime = 10.0f;  
-        newPowerup->next = *powerups;
-        *powerups = newPowerup;
-    }
+void InitPowerups(PowerupStore *powerups) {
+    memset(powerups, 0, sizeof(PowerupStore));
 }
 
 
-void UpdatePowerups(Powerup **powerups, float deltaTime) {
-    Powerup *current = *powerups;
-    Powerup *prev = NULL;
+int AddPowerupGroup(PowerupStore *powerups, const Vector2 *positions, const PowerupType *types, int count) {
+    // Vence no primeiro balde que começa depois de POWERUP_LIFETIME a partir de agora
+    int steps = (int)ceilf((POWERUP_LIFETIME + powerups->bucketTime) / POWERUP_WHEEL_STEP);
+    if (steps >= POWERUP_WHEEL_BUCKETS) steps = POWERUP_WHEEL_BUCKETS - 1;
+    int bucket = (powerups->cursor + steps) % POWERUP_WHEEL_BUCKETS;
     
-    while (current != NULL) {
-        
-        current->lifeTime -= deltaTime;
+    unsigned int group = 0;
+    int placed = 0;
+    for (int i = 0; i < POWERUP_SLOTS && placed < count; i++) {
+        if (powerups->slots[i].active) continue;
         
+        powerups->slots[i] = (Powerup){
+            .position = positions[placed],
+            .radius = POWERUP_RADIUS,
+            .type = types[placed],
+            .active = true,
+            .bucket = bucket
+        };
+        group |= 1u << i;
+        placed++;
+    }
+    
+    powerups->wheel[bucket] |= group;
+    for (int i = 0; i < POWERUP_SLOTS; i++) {
+        if (group & (1u << i)) powerups->slots[i].groupSlots = group;
+    }
+    return placed;
+}
+
+
+void UpdatePowerups(PowerupStore *powerups, float deltaTime) {
+    powerups->bucketTime += deltaTime;
+    
+    while (powerups->bucketTime >= POWERUP_WHEEL_STEP) {
+        powerups->bucketTime -= POWERUP_WHEEL_STEP;
+        powerups->cursor = (powerups->cursor + 1) % POWERUP_WHEEL_BUCKETS;
         
-        if (current->lifeTime <= 0.0f || !current->active) {
-            Powerup *toRemove = current;
-            
-            if (prev == NULL) {
-                
-                *powerups = current->next;
-                current = *powerups;
-            } else {
-                
-                prev->next = current->next;
-                current = current->next;
-            }
-            
-            free(toRemove);
-        } else {
-            prev = current;
-            current = current->next;
+        unsigned int expired = powerups->wheel[powerups->cursor];
+        if (expired) {
+            despawnSlots(powerups, expired);
         }
     }
 }
 
 
-void ClearPowerups(Powerup **powerups) {
-    Powerup *current = *powerups;
-    while (current != NULL) {
-        Powerup *next = current->next;
-        free(current);
-        current = next;
-    }
-    *powerups = NULL;
+void ClearPowerups(PowerupStore *powerups) {
+    InitPowerups(powerups);
 }
 
 
-bool CheckPowerupCollision(Powerup **powerups, Vector2 position, float radius, PowerupType *collectedType) {
-    Powerup *current = *powerups;
-   
-    bool collisionDetected = false;
-    
-    while (current != NULL) {
-        if (current->active) {
-            
-            float dx = current->position.x - position.x;
-            float dy = current->position.y - position.y;
-            float distance = sqrtf(dx * dx + dy * dy);
-            
-            
-            if (distance < current->radius + radius) {
-                *collectedType = current->type;
-                current->active = false;  
-                collisionDetected = true;
-                
-            }
-        }
+bool CheckPowerupCollision(PowerupStore *powerups, Vector2 position, float radius, PowerupType *collectedType) {
+    for (int i = 0; i < POWERUP_SLOTS; i++) {
+        const Powerup *powerup = &powerups->slots[i];
+        if (!powerup->active) continue;
         
-       
-        current = current->next;
-    }
-    
-    
-    if (collisionDetected) {
-        current = *powerups;
-        while (current != NULL) {
-            if (current->active) {
-                current->active = false;
-            }
-            current = current->next;
+        float dx = powerup->position.x - position.x;
+        float dy = powerup->position.y - position.y;
+        float reach = powerup->radius + radius;
+        
+        if (dx * dx + dy * dy < reach * reach) {
+            *collectedType = powerup->type;
+            despawnSlots(powerups, powerup->groupSlots);
+            return true;
         }
     }
     
-    return collisionDetected;
-}
\ No newline at end of file
+    return false;
+}
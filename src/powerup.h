@@ -3,6 +3,12 @@
 
 #include "raylib.h"
 
+#define POWERUP_SLOTS 12                 // até 4 trincas na tela ao mesmo tempo (máximo 32, um bit por slot)
+#define POWERUP_RADIUS 15.0f
+#define POWERUP_LIFETIME 10.0f
+#define POWERUP_WHEEL_BUCKETS 128        // a roda precisa cobrir POWERUP_LIFETIME
+#define POWERUP_WHEEL_STEP 0.125f        // segundos por balde
+
 
 typedef enum {
     POWERUP_DAMAGE,   
@@ -11,28 +17,37 @@ typedef enum {
 } PowerupType;
 
 
-typedef struct Powerup {
+typedef struct {
     Vector2 position;
     float radius;
     PowerupType type;
     bool active;
-    float lifeTime;    
-    struct Powerup *next;
+    unsigned int groupSlots;     // slots do mesmo grupo (inclui o próprio); coletar um some com todos
+    int bucket;                  // balde da roda em que vence
 } Powerup;
 
-
-void InitPowerups(Powerup **powerups);
+// Slots fixos e uma roda de tempo: cada balde guarda a máscara dos slots que
+// vencem nele, então avançar o tempo só olha os baldes que passaram
+typedef struct {
+    Powerup slots[POWERUP_SLOTS];
+    unsigned int wheel[POWERUP_WHEEL_BUCKETS];
+    int cursor;                  // balde atual
+    float bucketTime;            // tempo já corrido dentro do balde atual
+} PowerupStore;
 
 
-void AddPowerup(Powerup **powerups, Vector2 position, PowerupType type);
+void InitPowerups(PowerupStore *powerups);
 
+// Coloca count power-ups como um grupo; devolve quantos couberam nos slots livres
+int AddPowerupGroup(PowerupStore *powerups, const Vector2 *positions, const PowerupType *types, int count);
 
-void UpdatePowerups(Powerup **powerups, float deltaTime);
 
+void UpdatePowerups(PowerupStore *powerups, float deltaTime);
 
-void ClearPowerups(Powerup **powerups);
 
+void ClearPowerups(PowerupStore *powerups);
 
-bool CheckPowerupCollision(Powerup **powerups, Vector2 position, float radius, PowerupType *collectedType);
+// Coleta o primeiro power-up tocado e remove o grupo dele
+bool CheckPowerupCollision(PowerupStore *powerups, Vector2 position, float radius, PowerupType *collectedType);
 
-#endif 
\ No newline at end of file
+#endif 
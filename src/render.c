@@ -4,6 +4,12 @@
 #include "powerup.h"
 #include "game.h" 
 #include "scoreboard.h" 
+#include "text_cache.h"
+#include "instanced_render.h"
+#include "pixel_post.h"
+#include "screen_cache.h"
+#include "detail_level.h"
+#include "direction_table.h"
 #include <stdio.h>
 #include <math.h>
 #include <string.h>
@@ -24,6 +30,30 @@ typedef struct {
 static Explosion explosions[MAX_EXPLOSIONS] = {0};
 
 
+// Extensão máxima do desenho de cada entidade em múltiplos do raio (brilhos,
+// espinhos e canos passam do raio de colisão)
+#define ENEMY_DRAW_EXTENT 3.0f
+#define DYING_ENEMY_DRAW_EXTENT 5.0f
+#define POWERUP_DRAW_EXTENT 1.5f
+
+// Região visível do frame: o recorte da área de jogo durante DrawGameplay,
+// a tela inteira fora dele
+static Rectangle cullRect = { 0 };
+static bool cullRectActive = false;
+
+// Balas desenhadas no frame anterior, para a contagem do nível de detalhe
+static int lastBulletCount = 0;
+
+// Teste de caixa contra a região visível, feito antes de qualquer cálculo de desenho
+static bool isOnScreen(Vector2 center, float extent) {
+    Rectangle view = cullRectActive ? cullRect :
+                     (Rectangle){ 0.0f, 0.0f, (float)GetScreenWidth(), (float)GetScreenHeight() };
+    
+    return center.x + extent >= view.x && center.x - extent <= view.x + view.width &&
+           center.y + extent >= view.y && center.y - extent <= view.y + view.height;
+}
+
+
 void DrawPixelLine(float x1, float y1, float x2, float y2, Color color);
 void DrawPixelCircle(float centerX, float centerY, float radius, Color color);
 void DrawPixelCircleV(Vector2 center, float radius, Color color);
@@ -39,6 +69,12 @@ extern int GetScoreCount(void);
 
 
 void DrawPixelLine(float x1, float y1, float x2, float y2, Color color) {
+    // Dentro da cena pixelada o próprio render target faz a grade
+    if (IsPixelSceneActive()) {
+        DrawLineEx((Vector2){x1, y1}, (Vector2){x2, y2}, 2.0f, color);
+        return;
+    }
+    
     Vector2 start = {x1, y1};
     Vector2 end = {x2, y2};
     Vector2 delta = {end.x - start.x, end.y - start.y};
@@ -59,13 +95,22 @@ void DrawPixelLine(float x1, float y1, float x2, float y2, Color color) {
 
 
 
-void DrawGameplay(const Player *player, const EnemyList *enemies, const Bullet *bullets, const Bullet *enemyBullets, const Powerup *powerups, long score) {
+void DrawGameplay(const Player *player, const EnemyList *enemies, const BulletList *bullets, const BulletList *enemyBullets, const PowerupStore *powerups, const Boss *boss, long score) {
     // Desenhar HUD primeiro - agora passando o número de vidas do jogador
     DrawHUD(score, enemies->count, player->lives);
     
-    // Usar scissor mode para limitar o desenho da área de jogo
+    // Limitar o desenho à área de jogo (e pixelar na GPU, se o modo estiver ligado)
     float hudHeight = 60.0f;
-    BeginScissorMode(0, hudHeight, GetScreenWidth(), GetScreenHeight() - hudHeight);
+    BeginPixelatedScene((int)hudHeight);
+    
+    // Mesmo retângulo do recorte: o que ficar fora dele não é nem enviado
+    cullRect = (Rectangle){ 0.0f, hudHeight, (float)GetScreenWidth(), GetScreenHeight() - hudHeight };
+    cullRectActive = true;
+    
+    // Nível de detalhe deste frame: carga medida e quantidade de entidades
+    UpdateDetailLevel(GetFrameTime(), enemies->count + lastBulletCount);
+    DetailLevel detail = GetDetailLevel();
+    int bulletCount = 0;
     
     // Desenhar a área de jogo
     DrawPlayAreaBorder();
@@ -93,23 +138,31 @@ void DrawGameplay(const Player *player, const EnemyList *enemies, const Bullet *
             DrawPixelCircleV(player->position, player->radius * 1.5f * shieldPulse, shieldColor);
             
             
-            static float shieldRotation = 0.0f;
-            shieldRotation += GetFrameTime() * 2.0f;
+            // Ângulo em ponto fixo: dá a volta sozinho e não perde precisão com o tempo
+            static FixedAngle shieldRotation = 0;
+            shieldRotation += AngleFromRadians(GetFrameTime() * 2.0f);
             
-            for (int i = 0; i < 8; i++) {
-                float angle = shieldRotation + i * (PI/4);
-                Vector2 shieldPoint = {
-                    player->position.x + cosf(angle) * player->radius * 1.5f * shieldPulse,
-                    player->position.y + sinf(angle) * player->radius * 1.5f * shieldPulse
-                };
-                DrawPixelCircleV(shieldPoint, 3.0f, BLUE);
+            int shieldDots = (detail == DETAIL_FULL) ? 8 : (detail == DETAIL_REDUCED) ? 4 : 0;
+            if (shieldDots > 0) {
+                const Vector2 *ring = GetDirectionRing(shieldDots);
+                Vector2 rotation = DirectionFromAngle(shieldRotation);
+                float shieldRadius = player->radius * 1.5f * shieldPulse;
+                for (int i = 0; i < shieldDots; i++) {
+                    Vector2 offset = RotateDirection(ring[i], rotation);
+                    Vector2 shieldPoint = {
+                        player->position.x + offset.x * shieldRadius,
+                        player->position.y + offset.y * shieldRadius
+                    };
+                    DrawPixelCircleV(shieldPoint, 3.0f, BLUE);
+                }
             }
         }
         
         
         if (player->isDashing) {
             
-            for (int i = 1; i <= 8; i++) { 
+            int trailSteps = (detail == DETAIL_MINIMAL) ? 4 : 8;
+            for (int i = 1; i <= trailSteps; i++) { 
                 float alpha = 0.8f - (i * 0.09f); 
                 
                 
@@ -122,7 +175,7 @@ void DrawGameplay(const Player *player, const EnemyList *enemies, const Bullet *
                 DrawPixelCircleV(baseTrailPos, player->radius * (0.7f - i * 0.05f), Fade(RED, alpha));
                 
                 
-                if (i < 6) { 
+                if (i < 6 && detail == DETAIL_FULL) { 
                     for (int j = 0; j < 3; j++) {
                         float angle = GetTime() * 5.0f + i * 0.5f + j * 2.0f; 
                         float offset = player->radius * 0.4f * (1.0f - i * 0.1f); 
@@ -148,26 +201,44 @@ void DrawGameplay(const Player *player, const EnemyList *enemies, const Bullet *
     DrawEnemies(enemies);
 
     
+    bool useInstancing = IsInstancedRenderingEnabled();
+    
     if (bullets) {
-        const Bullet *currentBullet = bullets;
-        while (currentBullet) {
-            if (currentBullet->active) {
+        for (int b = 0; b < bullets->count; b++) {
+            const Bullet *currentBullet = &bullets->items[b];
+            // Alcance do rastro: 0.02 s de deslocamento para trás
+            float extent = currentBullet->radius + Vector2Length(currentBullet->velocity) * 0.02f;
+            if (!currentBullet->active || !isOnScreen(currentBullet->position, extent)) {
+                continue;
+            }
+            
+            bulletCount++;
+            
+            if (useInstancing) {
+                QueueEntityInstance(ENTITY_SHAPE_PLAYER_BULLET, currentBullet->position, currentBullet->velocity,
+                                    currentBullet->radius, 1.0f, 0.0f, 0.0f, detail, WHITE);
+            } else {
                 
                 DrawPixelCircleV(currentBullet->position, currentBullet->radius, WHITE);
                 
                 
-                Vector2 trail = Vector2Subtract(currentBullet->position, 
-                                           Vector2Scale(currentBullet->velocity, 0.02f));
-                DrawPixelCircleV(trail, currentBullet->radius * 0.6f, (Color){255, 255, 255, 120});
+                if (detail != DETAIL_MINIMAL) {
+                    Vector2 trail = Vector2Subtract(currentBullet->position, 
+                                               Vector2Scale(currentBullet->velocity, 0.02f));
+                    DrawPixelCircleV(trail, currentBullet->radius * 0.6f, (Color){255, 255, 255, 120});
+                }
             }
-            currentBullet = currentBullet->next;
+        }
+        
+        if (useInstancing) {
+            FlushEntityInstances();
         }
     }
 
     
     if (enemyBullets) {
-        const Bullet *currentBullet = enemyBullets;
-        while (currentBullet) {
+        for (int b = 0; b < enemyBullets->count; b++) {
+            const Bullet *currentBullet = &enemyBullets->items[b];
             if (currentBullet->active) {
                 
                 Vector2 pos = currentBullet->position;
@@ -176,6 +247,13 @@ void DrawGameplay(const Player *player, const EnemyList *enemies, const Bullet *
                 
                 static float rotationTime = 0.0f;
                 rotationTime += GetFrameTime() * 4.0f;
+                
+                // Quadrado girado mais dois rastros (0.06 s para trás)
+                float extent = radius * 1.3f + Vector2Length(currentBullet->velocity) * 0.06f;
+                if (!isOnScreen(pos, extent)) {
+                    continue;
+                }
+                bulletCount++;
                 float rotation = rotationTime + pos.x * 0.01f; 
                 
                 
@@ -184,6 +262,12 @@ void DrawGameplay(const Player *player, const EnemyList *enemies, const Bullet *
                 
                 Color enemyBulletColor = RED; 
                 
+                if (useInstancing) {
+                    QueueEntityInstance(ENTITY_SHAPE_ENEMY_BULLET, pos, currentBullet->velocity,
+                                        radius, 1.0f, rotation, 0.0f, detail, enemyBulletColor);
+                    continue;
+                }
+                
                 
                 for (int i = 0; i < 4; i++) {
                     float angle1 = rotation + i * (PI / 2);
@@ -207,20 +291,29 @@ void DrawGameplay(const Player *player, const EnemyList *enemies, const Bullet *
                 DrawCircleV(pos, radius * 0.5f, enemyBulletColor);
                 
                 
+                if (detail == DETAIL_MINIMAL) {
+                    continue;
+                }
                 Vector2 trail = Vector2Subtract(pos, Vector2Scale(currentBullet->velocity, 0.03f));
                 DrawCircleV(trail, radius * 0.4f, Fade(enemyBulletColor, 0.6f));
-                Vector2 trail2 = Vector2Subtract(pos, Vector2Scale(currentBullet->velocity, 0.06f));
-                DrawCircleV(trail2, radius * 0.3f, Fade(enemyBulletColor, 0.3f));
+                if (detail == DETAIL_FULL) {
+                    Vector2 trail2 = Vector2Subtract(pos, Vector2Scale(currentBullet->velocity, 0.06f));
+                    DrawCircleV(trail2, radius * 0.3f, Fade(enemyBulletColor, 0.3f));
+                }
             }
-            currentBullet = currentBullet->next;
+        }
+        
+        if (useInstancing) {
+            FlushEntityInstances();
         }
     }
 
     
     if (powerups) {
-        const Powerup *currentPowerup = powerups;
-        while (currentPowerup) {
-            if (currentPowerup->active) {
+        for (int i = 0; i < POWERUP_SLOTS; i++) {
+            const Powerup *currentPowerup = &powerups->slots[i];
+            if (currentPowerup->active &&
+                isOnScreen(currentPowerup->position, currentPowerup->radius * POWERUP_DRAW_EXTENT)) {
                 
                 float pulse = 0.8f + sinf(GetTime() * 3.0f) * 0.2f;
                 
@@ -296,7 +389,6 @@ void DrawGameplay(const Player *player, const EnemyList *enemies, const Bullet *
                     Fade(color, 0.3f)
                 );
             }
-            currentPowerup = currentPowerup->next;
         }
     }
 
@@ -327,7 +419,7 @@ void DrawGameplay(const Player *player, const EnemyList *enemies, const Bullet *
     DrawPixelText("LIVES", 20, 24, 30, Fade(WHITE, 0.9f));
     
     
-    int livesTextWidth = MeasureText("LIVES", 30);
+    int livesTextWidth = MeasureCachedText("LIVES", 30);
     
     
     DrawPixelRect(30 + livesTextWidth, 20, player->lives * 42 + 10, 28, Fade(WHITE, 0.15f));
@@ -374,23 +466,34 @@ void DrawGameplay(const Player *player, const EnemyList *enemies, const Bullet *
     scoreFlash = scoreFlash > 0.0f ? scoreFlash - GetFrameTime() * 2.0f : 0.0f;
     
     
-    const char* scoreText = TextFormat("%ld", score);
+    // Só reformatar quando o valor muda; o texto montado fica no cache
+    static long formattedScore = -1;
+    static char scoreText[24];
+    if (score != formattedScore) {
+        snprintf(scoreText, sizeof(scoreText), "%ld", score);
+        formattedScore = score;
+    }
     Color scoreColor = WHITE;
     
     if (scoreFlash > 0.0f) {
         scoreColor = Fade(WHITE, 0.7f + scoreFlash * 0.3f); 
     }
     
-    DrawPixelText(scoreText, centerX - MeasureText(scoreText, 38)/2, 15, 38, scoreColor);
+    DrawPixelText(scoreText, centerX - MeasureCachedText(scoreText, 38)/2, 15, 38, scoreColor);
     
     
-    DrawPixelText("SCORE", centerX - MeasureText("SCORE", 16)/2, 45, 16, Fade(LIGHTGRAY, 0.6f));
+    DrawPixelText("SCORE", centerX - MeasureCachedText("SCORE", 16)/2, 45, 16, Fade(LIGHTGRAY, 0.6f));
     
     
     if (enemies) {
         
-        const char* enemiesText = TextFormat("%d", enemies->count);
-        int textWidth = MeasureText(enemiesText, 28);
+        static int formattedCount = -1;
+        static char enemiesText[16];
+        if (enemies->count != formattedCount) {
+            snprintf(enemiesText, sizeof(enemiesText), "%d", enemies->count);
+            formattedCount = enemies->count;
+        }
+        int textWidth = MeasureCachedText(enemiesText, 28);
         int rightAlign = GetScreenWidth() - 20 - textWidth;
         
         
@@ -400,7 +503,7 @@ void DrawGameplay(const Player *player, const EnemyList *enemies, const Bullet *
         DrawPixelCircle(rightAlign - 20, 30, 8, Fade(RED, 0.7f)); 
         
         
-        DrawPixelText("ENEMIES", GetScreenWidth() - MeasureText("ENEMIES", 16) - 20, 45, 16, Fade(LIGHTGRAY, 0.6f));
+        DrawPixelText("ENEMIES", GetScreenWidth() - MeasureCachedText("ENEMIES", 16) - 20, 45, 16, Fade(LIGHTGRAY, 0.6f));
     }
     
     
@@ -410,7 +513,14 @@ void DrawGameplay(const Player *player, const EnemyList *enemies, const Bullet *
     }
 
     
-    EndScissorMode();
+    if (boss != NULL && boss->active) {
+        DrawBoss(boss);
+    }
+    
+    EndPixelatedScene();
+    cullRectActive = false;
+    
+    lastBulletCount = bulletCount;
     
     // Desenhar barra de dash na parte inferior da tela
     float dashCooldownRatio = player->dashCooldown / DASH_COOLDOWN;
@@ -438,7 +548,7 @@ void DrawGameplay(const Player *player, const EnemyList *enemies, const Bullet *
     }
     
     if (dashCooldownRatio <= 0.0f && !player->isDashing) {
-        DrawPixelText("READY", barX + barWidth - MeasureText("READY", 14), barY - 15, 14, 
+        DrawPixelText("READY", barX + barWidth - MeasureCachedText("READY", 14), barY - 15, 14, 
                      Fade(RED, 0.8f + sinf(GetTime() * 5.0f) * 0.2f));
     }
     
@@ -486,45 +596,52 @@ void DrawMainMenu(void) {
     
     
     const char *title = "M.A.G.";
-    int titleWidth = MeasureText(title, 120);
+    int titleWidth = MeasureCachedText(title, 120);
     
     
+    // As cópias do brilho só variam em opacidade: montar uma vez (no pico do
+    // pulso) e compor a camada inteira com a opacidade do frame
+    const float maxTitlePulse = 1.1f;
     float titlePulse = 1.0f + sinf(animTime * 3.0f) * 0.1f;
-    for (int i = 10; i > 0; i -= 2) {
-        DrawText(title, 
-                GetScreenWidth()/2 - titleWidth/2 - i, 
-                GetScreenHeight()/3 - i, 
-                120, 
-                Fade(RED, 0.05f * i * titlePulse));
+    if (BeginScreenCache(SCREEN_CACHE_MAIN_MENU, 0)) {
+        for (int i = 10; i > 0; i -= 2) {
+            DrawText(title, 
+                    GetScreenWidth()/2 - titleWidth/2 - i, 
+                    GetScreenHeight()/3 - i, 
+                    120, 
+                    Fade(RED, 0.05f * i * maxTitlePulse));
+        }
+        EndScreenCache();
     }
+    DrawScreenCache(SCREEN_CACHE_MAIN_MENU, titlePulse / maxTitlePulse);
     
     
-    DrawText(title, 
-            GetScreenWidth()/2 - titleWidth/2, 
-            GetScreenHeight()/3, 
-            120, 
-            Fade(WHITE, 0.8f + sinf(animTime * 4.0f) * 0.2f));
+    DrawCachedText(title, 
+                   GetScreenWidth()/2 - titleWidth/2, 
+                   GetScreenHeight()/3, 
+                   120, 
+                   Fade(WHITE, 0.8f + sinf(animTime * 4.0f) * 0.2f));
     
     
     const char *subtitle = "O inimigo agora é outro";
-    int subtitleWidth = MeasureText(subtitle, 30);
-    DrawText(subtitle, 
-            GetScreenWidth()/2 - subtitleWidth/2, 
-            GetScreenHeight()/3 + 100, 
-            30, 
-            Fade(WHITE, 0.5f + sinf(animTime * 2.0f) * 0.2f));
+    int subtitleWidth = MeasureCachedText(subtitle, 30);
+    DrawCachedText(subtitle, 
+                   GetScreenWidth()/2 - subtitleWidth/2, 
+                   GetScreenHeight()/3 + 100, 
+                   30, 
+                   Fade(WHITE, 0.5f + sinf(animTime * 2.0f) * 0.2f));
     
     
     const char *startOption = "PRESS ANY KEY TO START";  
-    int startWidth = MeasureText(startOption, 30);
+    int startWidth = MeasureCachedText(startOption, 30);
     
     
     float startPulse = 0.6f + sinf(animTime * 5.0f) * 0.4f;
-    DrawText(startOption, 
-            GetScreenWidth()/2 - startWidth/2, 
-            GetScreenHeight()/2 + 200, 
-            30, 
-            Fade(RED, startPulse));
+    DrawCachedText(startOption, 
+                   GetScreenWidth()/2 - startWidth/2, 
+                   GetScreenHeight()/2 + 200, 
+                   30, 
+                   Fade(RED, startPulse));
     
     
     DrawMinimalistCursor();
@@ -533,6 +650,9 @@ void DrawMainMenu(void) {
 
 
 void DrawMinimalistCursor(void) {
+    // O cursor nunca entra em uma camada em cache (ficaria congelado na imagem)
+    if (IsScreenCacheCapturing()) return;
+    
     HideCursor();
     Vector2 mousePos = GetMousePosition();
     Color cursorColor = WHITE;
@@ -593,6 +713,11 @@ void DrawMinimalistCursor(void) {
 
 
 void DrawPixelCircle(float centerX, float centerY, float radius, Color color) {
+    if (IsPixelSceneActive()) {
+        DrawCircleV((Vector2){centerX, centerY}, radius, color);
+        return;
+    }
+    
     
     const float pixelSize = 3.0f;
     
@@ -631,11 +756,16 @@ void DrawPixelText(const char *text, int posX, int posY, int fontSize, Color col
     int snapX = (int)(posX / pixelGrid) * pixelGrid;
     int snapY = (int)(posY / pixelGrid) * pixelGrid;
     
-    DrawText(text, snapX, snapY, scaledFontSize, color);
+    DrawCachedText(text, snapX, snapY, scaledFontSize, color);
 }
 
 
 void DrawPixelRect(float x, float y, float width, float height, Color color) {
+    if (IsPixelSceneActive()) {
+        DrawRectangleV((Vector2){x, y}, (Vector2){width, height}, color);
+        return;
+    }
+    
     const float pixelSize = 3.0f;
     
     int minX = (int)(x / pixelSize) * pixelSize;
@@ -653,251 +783,364 @@ void DrawPixelRect(float x, float y, float width, float height, Color color) {
 
 
 
+// Silhueta do inimigo no detalhe mínimo: corpo e miolo, sem decorações
+static void drawEnemySilhouette(const Enemy *enemy) {
+    float radius = enemy->radius;
+    Vector2 pos = enemy->position;
+    
+    switch (enemy->type) {
+        case ENEMY_TYPE_NORMAL: {
+            float squareSize = radius * 1.8f;
+            DrawPixelRect(pos.x - squareSize/2, pos.y - squareSize/2, squareSize, squareSize, WHITE);
+            DrawPixelRect(pos.x - squareSize*0.35f, pos.y - squareSize*0.35f, squareSize*0.7f, squareSize*0.7f, BLACK);
+            break;
+        }
+        case ENEMY_TYPE_SPEEDER:
+            DrawPixelCircleV(pos, radius, SKYBLUE);
+            DrawPixelCircleV(pos, radius * 0.7f, BLACK);
+            break;
+        case ENEMY_TYPE_TANK:
+            DrawPixelCircleV(pos, radius * 1.3f, DARKGRAY);
+            DrawPixelCircleV(pos, radius * 0.7f, GRAY);
+            break;
+        case ENEMY_TYPE_EXPLODER:
+            DrawPixelCircleV(pos, radius * 0.7f, RED);
+            DrawPixelCircleV(pos, radius * 0.5f, BLACK);
+            break;
+        case ENEMY_TYPE_SHOOTER:
+            DrawPixelCircleV(pos, radius * 0.8f, YELLOW);
+            DrawPixelCircleV(pos, radius * 0.65f, BLACK);
+            break;
+    }
+}
+
+
+// Versão desenhada na CPU com as primitivas pixeladas
+static void drawEnemyPrimitives(const Enemy *currentEnemy, float pulseFactor, DetailLevel detail) {
+    if (detail == DETAIL_MINIMAL) {
+        drawEnemySilhouette(currentEnemy);
+        return;
+    }
+    
+    bool fullDetail = (detail == DETAIL_FULL);
+    float radius = currentEnemy->radius;
+    Vector2 pos = currentEnemy->position;
+    
+    switch (currentEnemy->type) {
+        case ENEMY_TYPE_NORMAL:
+            
+            {
+                
+                float squareSize = radius * 1.8f * pulseFactor;
+                
+                
+                DrawPixelRect(pos.x - squareSize/2, pos.y - squareSize/2, squareSize, squareSize, WHITE);
+                DrawPixelRect(pos.x - squareSize*0.7f/2, pos.y - squareSize*0.7f/2, squareSize*0.7f, squareSize*0.7f, BLACK);
+                DrawPixelRect(pos.x - squareSize*0.4f/2, pos.y - squareSize*0.4f/2, squareSize*0.4f, squareSize*0.4f, WHITE);
+                
+                
+                if (fullDetail) {
+                    DrawPixelCircleV(pos, radius * 0.15f, WHITE);
+                }
+            }
+            break;
+            
+        case ENEMY_TYPE_SPEEDER:
+            
+            {
+                
+                Vector2 dir = Vector2Normalize(currentEnemy->velocity);
+                if (Vector2Length(currentEnemy->velocity) < 0.1f) {
+                    dir = (Vector2){0, -1}; 
+                }
+                
+                
+                DrawPixelCircleV(pos, radius * pulseFactor, SKYBLUE);
+                DrawPixelCircleV(pos, radius * 0.7f * pulseFactor, BLACK);
+                
+                
+                Vector2 tipPos = Vector2Add(pos, Vector2Scale(dir, radius * 0.9f));
+                DrawPixelCircleV(tipPos, radius * 0.4f, SKYBLUE);
+                
+                
+                Vector2 perpendicular = (Vector2){-dir.y, dir.x};
+                
+                
+                Vector2 leftWing = Vector2Add(pos, Vector2Scale(perpendicular, radius * 0.8f));
+                DrawPixelCircleV(leftWing, radius * 0.3f, SKYBLUE);
+                
+                
+                Vector2 rightWing = Vector2Subtract(pos, Vector2Scale(perpendicular, radius * 0.8f));
+                DrawPixelCircleV(rightWing, radius * 0.3f, SKYBLUE);
+                
+                
+                if (Vector2Length(currentEnemy->velocity) > 50.0f) {
+                    Vector2 exhaustPos = Vector2Subtract(pos, Vector2Scale(dir, radius * 0.9f));
+                    float exhaustPulse = 0.7f + sinf(GetTime() * 10.0f) * 0.3f;
+                    
+                    DrawPixelCircleV(exhaustPos, radius * 0.5f * exhaustPulse, Fade(SKYBLUE, 0.7f));
+                    if (fullDetail) {
+                        DrawPixelCircleV(Vector2Subtract(exhaustPos, Vector2Scale(dir, radius * 0.3f)), 
+                                      radius * 0.3f * exhaustPulse, Fade(SKYBLUE, 0.5f));
+                        DrawPixelCircleV(Vector2Subtract(exhaustPos, Vector2Scale(dir, radius * 0.6f)), 
+                                      radius * 0.2f * exhaustPulse, Fade(SKYBLUE, 0.3f));
+                    }
+                }
+            }
+            break;
+            
+        case ENEMY_TYPE_TANK:
+            
+            {
+                
+                DrawPixelCircleV(pos, radius * 1.3f * pulseFactor, DARKGRAY);
+                DrawPixelCircleV(pos, radius * 0.9f * pulseFactor, BLACK);
+                DrawPixelCircleV(pos, radius * 0.7f * pulseFactor, GRAY);
+                
+                
+                float towerRotation = GetTime() * 0.5f;
+                int towerPoints = fullDetail ? 8 : 4;
+                
+                for (int i = 0; i < towerPoints; i++) {
+                    float angle = towerRotation + i * (2.0f * PI / towerPoints);
+                    Vector2 point = {
+                        pos.x + cosf(angle) * radius * 0.6f * pulseFactor,
+                        pos.y + sinf(angle) * radius * 0.6f * pulseFactor
+                    };
+                    
+                    DrawPixelCircleV(point, radius * 0.15f, DARKGRAY);
+                }
+                
+                
+                Vector2 dir = Vector2Normalize(currentEnemy->velocity);
+                if (Vector2Length(currentEnemy->velocity) < 0.1f) {
+                    dir = (Vector2){1, 0};
+                }
+                
+                
+                float cannonStep = fullDetail ? 0.2f : 0.5f;
+                for (float t = 0; t <= 1.0f; t += cannonStep) {
+                    Vector2 pointOnCannon = {
+                        pos.x + dir.x * radius * 1.5f * t,
+                        pos.y + dir.y * radius * 1.5f * t
+                    };
+                    float pointSize = radius * 0.25f * (1.0f - t * 0.3f);
+                    DrawPixelCircleV(pointOnCannon, pointSize, DARKGRAY);
+                }
+                
+                
+                Vector2 cannonTip = Vector2Add(pos, Vector2Scale(dir, radius * 1.5f));
+                DrawPixelCircleV(cannonTip, radius * 0.15f, LIGHTGRAY);
+                
+                
+                Vector2 perp = (Vector2){-dir.y, dir.x};
+                float trackStep = fullDetail ? 0.2f : 0.5f;
+                
+                
+                for (float t = -0.5f; t <= 0.5f; t += trackStep) {
+                    Vector2 trackPoint = {
+                        pos.x + dir.x * radius * t - perp.x * radius * 0.8f,
+                        pos.y + dir.y * radius * t - perp.y * radius * 0.8f
+                    };
+                    DrawPixelCircleV(trackPoint, radius * 0.12f, DARKGRAY);
+                }
+                
+                
+                for (float t = -0.5f; t <= 0.5f; t += trackStep) {
+                    Vector2 trackPoint = {
+                        pos.x + dir.x * radius * t + perp.x * radius * 0.8f,
+                        pos.y + dir.y * radius * t + perp.y * radius * 0.8f
+                    };
+                    DrawPixelCircleV(trackPoint, radius * 0.12f, DARKGRAY);
+                }
+                
+                
+                DrawPixelCircleV(pos, radius * 0.2f, LIGHTGRAY);
+            }
+            break;
+            
+        case ENEMY_TYPE_EXPLODER:
+            
+            {
+                
+                DrawPixelCircleV(pos, radius * 0.7f * pulseFactor, RED);
+                DrawPixelCircleV(pos, radius * 0.5f * pulseFactor, BLACK);
+                
+                
+                int spikes = fullDetail ? 8 : 4;
+                float spikeAngle = 2.0f * PI / spikes;
+                float rotation = GetTime() * 3.0f;
+                // No detalhe reduzido todos os espinhos usam o mesmo pulso
+                float sharedSpikePulse = 0.8f + sinf(GetTime() * 5.0f) * 0.2f;
+                
+                for (int i = 0; i < spikes; i++) {
+                    float angle = rotation + i * spikeAngle;
+                    float spikePulse = fullDetail ? 0.8f + sinf(GetTime() * 5.0f + i) * 0.2f : sharedSpikePulse;
+                    
+                    
+                    Vector2 innerPoint = {
+                        pos.x + cosf(angle) * radius * 0.5f,
+                        pos.y + sinf(angle) * radius * 0.5f
+                    };
+                    
+                    Vector2 outerPoint = {
+                        pos.x + cosf(angle) * radius * 1.3f * spikePulse,
+                        pos.y + sinf(angle) * radius * 1.3f * spikePulse
+                    };
+                    
+                    DrawPixelLine(innerPoint.x, innerPoint.y, outerPoint.x, outerPoint.y, RED);
+                    DrawPixelCircleV(outerPoint, radius * 0.15f, RED);
+                }
+                
+                
+                float corePulse = 0.7f + sinf(GetTime() * 8.0f) * 0.3f;
+                DrawPixelCircleV(pos, radius * 0.3f * corePulse, RED);
+                
+                
+                if (corePulse > 0.9f) {
+                    DrawPixelCircleV(pos, radius * pulseFactor * 1.5f, Fade(RED, corePulse * 0.2f));
+                }
+            }
+            break;
+            
+        case ENEMY_TYPE_SHOOTER:
+            
+            {
+                
+                DrawPixelCircleV(pos, radius * 0.8f * pulseFactor, YELLOW);
+                DrawPixelCircleV(pos, radius * 0.65f * pulseFactor, BLACK);
+                DrawPixelCircleV(pos, radius * 0.5f * pulseFactor, YELLOW);
+                
+                
+                float rotationSpeed = GetTime() * 1.5f + currentEnemy->shootTimer * 3.0f;
+                int numCannons = fullDetail ? 5 : 3;
+                
+                for (int i = 0; i < numCannons; i++) {
+                    float angle = rotationSpeed + i * (2.0f * PI / numCannons);
+                    
+                    Vector2 cannonBase = {
+                        pos.x + cosf(angle) * radius * 0.5f,
+                        pos.y + sinf(angle) * radius * 0.5f
+                    };
+                    
+                    Vector2 cannonTip = {
+                        pos.x + cosf(angle) * (radius * 1.1f * pulseFactor),
+                        pos.y + sinf(angle) * (radius * 1.1f * pulseFactor)
+                    };
+                    
+                    
+                    DrawPixelLine(cannonBase.x, cannonBase.y, cannonTip.x, cannonTip.y, YELLOW);
+                    
+                    
+                    if (currentEnemy->shootTimer > 0.5f) {
+                        float chargeRatio = (currentEnemy->shootTimer - 0.5f) / 0.5f;
+                        DrawPixelCircleV(cannonTip, radius * 0.18f * chargeRatio, 
+                                     Fade(WHITE, 0.4f + chargeRatio * 0.6f));
+                    }
+                }
+                
+                
+                float corePulse = 0.7f;
+                if (currentEnemy->shootTimer > 0.3f) {
+                    corePulse = 0.7f + sinf(GetTime() * 8.0f) * 0.3f * 
+                              ((currentEnemy->shootTimer - 0.3f) / 0.7f);
+                }
+                
+                DrawPixelCircleV(pos, radius * 0.35f * corePulse, Fade(YELLOW, 0.7f + corePulse * 0.3f));
+                
+                
+                if (currentEnemy->shootTimer > 0.7f) {
+                    float chargeRatio = (currentEnemy->shootTimer - 0.7f) / 0.3f;
+                    DrawPixelCircleV(pos, radius * pulseFactor * (1.0f + chargeRatio * 0.2f), 
+                                 Fade(YELLOW, 0.2f * chargeRatio));
+                }
+            }
+            break;
+    }
+}
+
+
+// Mesma entidade descrita como uma instância para o shader
+static void queueEnemyInstance(const Enemy *enemy, float pulseFactor, DetailLevel detail) {
+    Vector2 dir = Vector2Normalize(enemy->velocity);
+    bool stopped = Vector2Length(enemy->velocity) < 0.1f;
+    
+    switch (enemy->type) {
+        case ENEMY_TYPE_SPEEDER:
+            if (stopped) dir = (Vector2){0, -1};
+            QueueEntityInstance(ENTITY_SHAPE_SPEEDER, enemy->position, enemy->velocity, enemy->radius,
+                                pulseFactor, atan2f(dir.y, dir.x), 0.0f, detail, SKYBLUE);
+            break;
+        case ENEMY_TYPE_TANK:
+            if (stopped) dir = (Vector2){1, 0};
+            QueueEntityInstance(ENTITY_SHAPE_TANK, enemy->position, enemy->velocity, enemy->radius,
+                                pulseFactor, atan2f(dir.y, dir.x), 0.0f, detail, DARKGRAY);
+            break;
+        case ENEMY_TYPE_EXPLODER:
+            QueueEntityInstance(ENTITY_SHAPE_EXPLODER, enemy->position, enemy->velocity, enemy->radius,
+                                pulseFactor, 0.0f, 0.0f, detail, RED);
+            break;
+        case ENEMY_TYPE_SHOOTER:
+            QueueEntityInstance(ENTITY_SHAPE_SHOOTER, enemy->position, enemy->velocity, enemy->radius,
+                                pulseFactor, 0.0f, enemy->shootTimer, detail, YELLOW);
+            break;
+        case ENEMY_TYPE_NORMAL:
+        default:
+            QueueEntityInstance(ENTITY_SHAPE_NORMAL, enemy->position, enemy->velocity, enemy->radius,
+                                pulseFactor, 0.0f, 0.0f, detail, WHITE);
+            break;
+    }
+}
+
+
 void DrawEnemies(const EnemyList *enemies) {
     if (enemies) {
+        bool useInstancing = IsInstancedRenderingEnabled();
+        DetailLevel detail = GetDetailLevel();
+        
+        static float pulseTime = 0.0f;
+        float sharedPulse = 1.0f + sinf(pulseTime) * 0.1f;
+        
         const Enemy *currentEnemy = enemies->head;
         while (currentEnemy != NULL) {
             if (currentEnemy->active) {
                 
-                float radius = currentEnemy->radius;
-                Vector2 pos = currentEnemy->position;
-                
                 
-                static float pulseTime = 0.0f;
                 pulseTime += GetFrameTime() * 2.0f;
-                float pulseFactor = 1.0f + sinf(pulseTime + currentEnemy->position.x * 0.01f) * 0.1f;
                 
+                // Inimigos recém-criados nascem fora do círculo e muitas vezes fora da tela
+                if (!isOnScreen(currentEnemy->position, currentEnemy->radius * ENEMY_DRAW_EXTENT)) {
+                    currentEnemy = currentEnemy->next;
+                    continue;
+                }
+                // Pulso com fase por inimigo só no detalhe cheio; abaixo disso um seno
+                // por inimigo vira um valor comum, e no mínimo nenhum
+                float pulseFactor = 1.0f;
+                if (detail == DETAIL_FULL) {
+                    pulseFactor = 1.0f + sinf(pulseTime + currentEnemy->position.x * 0.01f) * 0.1f;
+                } else if (detail == DETAIL_REDUCED) {
+                    pulseFactor = sharedPulse;
+                }
                 
-                switch (currentEnemy->type) {
-                    case ENEMY_TYPE_NORMAL:
-                        
-                        {
-                            
-                            float squareSize = radius * 1.8f * pulseFactor;
-                            
-                            
-                            DrawPixelRect(pos.x - squareSize/2, pos.y - squareSize/2, squareSize, squareSize, WHITE);
-                            DrawPixelRect(pos.x - squareSize*0.7f/2, pos.y - squareSize*0.7f/2, squareSize*0.7f, squareSize*0.7f, BLACK);
-                            DrawPixelRect(pos.x - squareSize*0.4f/2, pos.y - squareSize*0.4f/2, squareSize*0.4f, squareSize*0.4f, WHITE);
-                            
-                            
-                            DrawPixelCircleV(pos, radius * 0.15f, WHITE);
-                        }
-                        break;
-                        
-                    case ENEMY_TYPE_SPEEDER:
-                        
-                        {
-                            
-                            Vector2 dir = Vector2Normalize(currentEnemy->velocity);
-                            if (Vector2Length(currentEnemy->velocity) < 0.1f) {
-                                dir = (Vector2){0, -1}; 
-                            }
-                            
-                            
-                            DrawPixelCircleV(pos, radius * pulseFactor, SKYBLUE);
-                            DrawPixelCircleV(pos, radius * 0.7f * pulseFactor, BLACK);
-                            
-                            
-                            Vector2 tipPos = Vector2Add(pos, Vector2Scale(dir, radius * 0.9f));
-                            DrawPixelCircleV(tipPos, radius * 0.4f, SKYBLUE);
-                            
-                            
-                            Vector2 perpendicular = (Vector2){-dir.y, dir.x};
-                            
-                            
-                            Vector2 leftWing = Vector2Add(pos, Vector2Scale(perpendicular, radius * 0.8f));
-                            DrawPixelCircleV(leftWing, radius * 0.3f, SKYBLUE);
-                            
-                            
-                            Vector2 rightWing = Vector2Subtract(pos, Vector2Scale(perpendicular, radius * 0.8f));
-                            DrawPixelCircleV(rightWing, radius * 0.3f, SKYBLUE);
-                            
-                            
-                            if (Vector2Length(currentEnemy->velocity) > 50.0f) {
-                                Vector2 exhaustPos = Vector2Subtract(pos, Vector2Scale(dir, radius * 0.9f));
-                                float exhaustPulse = 0.7f + sinf(GetTime() * 10.0f) * 0.3f;
-                                
-                                DrawPixelCircleV(exhaustPos, radius * 0.5f * exhaustPulse, Fade(SKYBLUE, 0.7f));
-                                DrawPixelCircleV(Vector2Subtract(exhaustPos, Vector2Scale(dir, radius * 0.3f)), 
-                                              radius * 0.3f * exhaustPulse, Fade(SKYBLUE, 0.5f));
-                                DrawPixelCircleV(Vector2Subtract(exhaustPos, Vector2Scale(dir, radius * 0.6f)), 
-                                              radius * 0.2f * exhaustPulse, Fade(SKYBLUE, 0.3f));
-                            }
-                        }
-                        break;
-                        
-                    case ENEMY_TYPE_TANK:
-                        
-                        {
-                            
-                            DrawPixelCircleV(pos, radius * 1.3f * pulseFactor, DARKGRAY);
-                            DrawPixelCircleV(pos, radius * 0.9f * pulseFactor, BLACK);
-                            DrawPixelCircleV(pos, radius * 0.7f * pulseFactor, GRAY);
-                            
-                            
-                            float towerRotation = GetTime() * 0.5f;
-                            int towerPoints = 8;
-                            
-                            for (int i = 0; i < towerPoints; i++) {
-                                float angle = towerRotation + i * (2.0f * PI / towerPoints);
-                                Vector2 point = {
-                                    pos.x + cosf(angle) * radius * 0.6f * pulseFactor,
-                                    pos.y + sinf(angle) * radius * 0.6f * pulseFactor
-                                };
-                                
-                                DrawPixelCircleV(point, radius * 0.15f, DARKGRAY);
-                            }
-                            
-                            
-                            Vector2 dir = Vector2Normalize(currentEnemy->velocity);
-                            if (Vector2Length(currentEnemy->velocity) < 0.1f) {
-                                dir = (Vector2){1, 0};
-                            }
-                            
-                            
-                            for (float t = 0; t <= 1.0f; t += 0.2f) {
-                                Vector2 pointOnCannon = {
-                                    pos.x + dir.x * radius * 1.5f * t,
-                                    pos.y + dir.y * radius * 1.5f * t
-                                };
-                                float pointSize = radius * 0.25f * (1.0f - t * 0.3f);
-                                DrawPixelCircleV(pointOnCannon, pointSize, DARKGRAY);
-                            }
-                            
-                            
-                            Vector2 cannonTip = Vector2Add(pos, Vector2Scale(dir, radius * 1.5f));
-                            DrawPixelCircleV(cannonTip, radius * 0.15f, LIGHTGRAY);
-                            
-                            
-                            Vector2 perp = (Vector2){-dir.y, dir.x};
-                            
-                            
-                            for (float t = -0.5f; t <= 0.5f; t += 0.2f) {
-                                Vector2 trackPoint = {
-                                    pos.x + dir.x * radius * t - perp.x * radius * 0.8f,
-                                    pos.y + dir.y * radius * t - perp.y * radius * 0.8f
-                                };
-                                DrawPixelCircleV(trackPoint, radius * 0.12f, DARKGRAY);
-                            }
-                            
-                            
-                            for (float t = -0.5f; t <= 0.5f; t += 0.2f) {
-                                Vector2 trackPoint = {
-                                    pos.x + dir.x * radius * t + perp.x * radius * 0.8f,
-                                    pos.y + dir.y * radius * t + perp.y * radius * 0.8f
-                                };
-                                DrawPixelCircleV(trackPoint, radius * 0.12f, DARKGRAY);
-                            }
-                            
-                            
-                            DrawPixelCircleV(pos, radius * 0.2f, LIGHTGRAY);
-                        }
-                        break;
-                        
-                    case ENEMY_TYPE_EXPLODER:
-                        
-                        {
-                            
-                            DrawPixelCircleV(pos, radius * 0.7f * pulseFactor, RED);
-                            DrawPixelCircleV(pos, radius * 0.5f * pulseFactor, BLACK);
-                            
-                            
-                            int spikes = 8;
-                            float spikeAngle = 2.0f * PI / spikes;
-                            float rotation = GetTime() * 3.0f;
-                            
-                            for (int i = 0; i < spikes; i++) {
-                                float angle = rotation + i * spikeAngle;
-                                float spikePulse = 0.8f + sinf(GetTime() * 5.0f + i) * 0.2f;
-                                
-                                
-                                Vector2 innerPoint = {
-                                    pos.x + cosf(angle) * radius * 0.5f,
-                                    pos.y + sinf(angle) * radius * 0.5f
-                                };
-                                
-                                Vector2 outerPoint = {
-                                    pos.x + cosf(angle) * radius * 1.3f * spikePulse,
-                                    pos.y + sinf(angle) * radius * 1.3f * spikePulse
-                                };
-                                
-                                DrawPixelLine(innerPoint.x, innerPoint.y, outerPoint.x, outerPoint.y, RED);
-                                DrawPixelCircleV(outerPoint, radius * 0.15f, RED);
-                            }
-                            
-                            
-                            float corePulse = 0.7f + sinf(GetTime() * 8.0f) * 0.3f;
-                            DrawPixelCircleV(pos, radius * 0.3f * corePulse, RED);
-                            
-                            
-                            if (corePulse > 0.9f) {
-                                DrawPixelCircleV(pos, radius * pulseFactor * 1.5f, Fade(RED, corePulse * 0.2f));
-                            }
-                        }
-                        break;
-                        
-                    case ENEMY_TYPE_SHOOTER:
-                        
-                        {
-                            
-                            DrawPixelCircleV(pos, radius * 0.8f * pulseFactor, YELLOW);
-                            DrawPixelCircleV(pos, radius * 0.65f * pulseFactor, BLACK);
-                            DrawPixelCircleV(pos, radius * 0.5f * pulseFactor, YELLOW);
-                            
-                            
-                            float rotationSpeed = GetTime() * 1.5f + currentEnemy->shootTimer * 3.0f;
-                            int numCannons = 5;
-                            
-                            for (int i = 0; i < numCannons; i++) {
-                                float angle = rotationSpeed + i * (2.0f * PI / numCannons);
-                                
-                                Vector2 cannonBase = {
-                                    pos.x + cosf(angle) * radius * 0.5f,
-                                    pos.y + sinf(angle) * radius * 0.5f
-                                };
-                                
-                                Vector2 cannonTip = {
-                                    pos.x + cosf(angle) * (radius * 1.1f * pulseFactor),
-                                    pos.y + sinf(angle) * (radius * 1.1f * pulseFactor)
-                                };
-                                
-                                
-                                DrawPixelLine(cannonBase.x, cannonBase.y, cannonTip.x, cannonTip.y, YELLOW);
-                                
-                                
-                                if (currentEnemy->shootTimer > 0.5f) {
-                                    float chargeRatio = (currentEnemy->shootTimer - 0.5f) / 0.5f;
-                                    DrawPixelCircleV(cannonTip, radius * 0.18f * chargeRatio, 
-                                                 Fade(WHITE, 0.4f + chargeRatio * 0.6f));
-                                }
-                            }
-                            
-                            
-                            float corePulse = 0.7f;
-                            if (currentEnemy->shootTimer > 0.3f) {
-                                corePulse = 0.7f + sinf(GetTime() * 8.0f) * 0.3f * 
-                                          ((currentEnemy->shootTimer - 0.3f) / 0.7f);
-                            }
-                            
-                            DrawPixelCircleV(pos, radius * 0.35f * corePulse, Fade(YELLOW, 0.7f + corePulse * 0.3f));
-                            
-                            
-                            if (currentEnemy->shootTimer > 0.7f) {
-                                float chargeRatio = (currentEnemy->shootTimer - 0.7f) / 0.3f;
-                                DrawPixelCircleV(pos, radius * pulseFactor * (1.0f + chargeRatio * 0.2f), 
-                                             Fade(YELLOW, 0.2f * chargeRatio));
-                            }
-                        }
-                        break;
+                
+                if (useInstancing) {
+                    queueEnemyInstance(currentEnemy, pulseFactor, detail);
+                } else {
+                    drawEnemyPrimitives(currentEnemy, pulseFactor, detail);
                 }
             }
-            else if (currentEnemy->isDying) {
+            else if (currentEnemy->isDying &&
+                     isOnScreen(currentEnemy->position, currentEnemy->radius * DYING_ENEMY_DRAW_EXTENT)) {
                 DrawEnemyDeathAnimation(currentEnemy);  
             }
             
             currentEnemy = currentEnemy->next;
         }
+        
+        // Todos os inimigos vivos em uma única chamada instanciada
+        if (useInstancing) {
+            FlushEntityInstances();
+        }
     }
 }
 
@@ -907,6 +1150,10 @@ void DrawEnemyDeathAnimation(const Enemy *enemy) {
     Vector2 pos = enemy->position;
     float radius = enemy->radius;
     
+    // Com o detalhe reduzido as partículas são desenhadas de duas em duas (ou quatro em quatro)
+    DetailLevel detail = GetDetailLevel();
+    int particleStep = (detail == DETAIL_FULL) ? 1 : (detail == DETAIL_REDUCED) ? 2 : 4;
+    
     switch (enemy->type) {
         case ENEMY_TYPE_NORMAL:
             
@@ -923,7 +1170,7 @@ void DrawEnemyDeathAnimation(const Enemy *enemy) {
             if (Vector2Length(enemy->velocity) > 0) {
                 Vector2 velDir = Vector2Normalize(enemy->velocity);
                 
-                for (int i = 0; i < 5; i++) {
+                for (int i = 0; i < 5; i += particleStep) {
                     float distance = radius * (0.5f + i * 0.5f) * completionRatio * 3.0f;
                     Vector2 particlePos = Vector2Add(pos, Vector2Scale(velDir, distance));
                     
@@ -944,13 +1191,13 @@ void DrawEnemyDeathAnimation(const Enemy *enemy) {
             }
             
             
-            for (int i = 0; i < 8; i++) {
-                float angle = i * PI/4.0f;
+            const Vector2 *fragmentRing = GetDirectionRing(8);
+            for (int i = 0; i < 8; i += particleStep) {
                 float distance = radius * completionRatio * 2.0f;
                 
                 Vector2 fragmentPos = {
-                    pos.x + cosf(angle) * distance,
-                    pos.y + sinf(angle) * distance
+                    pos.x + fragmentRing[i].x * distance,
+                    pos.y + fragmentRing[i].y * distance
                 };
                 
                 DrawPixelCircleV(fragmentPos, radius * (1.0f - completionRatio) * 0.2f, 
@@ -973,13 +1220,13 @@ void DrawEnemyDeathAnimation(const Enemy *enemy) {
             }
             
             
-            for (int i = 0; i < 15; i++) {
-                float angle = i * 24.0f * DEG2RAD; 
+            const Vector2 *particleRing = GetDirectionRing(15);
+            for (int i = 0; i < 15; i += particleStep) {
                 float dist = radius * completionRatio * (1.0f + (i % 5) * 0.4f);
                 
                 Vector2 particlePos = {
-                    pos.x + cosf(angle) * dist,
-                    pos.y + sinf(angle) * dist
+                    pos.x + particleRing[i].x * dist,
+                    pos.y + particleRing[i].y * dist
                 };
                 
                 Color particleColor = (i % 2 == 0) ? RED : ORANGE;
@@ -1000,13 +1247,15 @@ void DrawEnemyDeathAnimation(const Enemy *enemy) {
             }
             
             
+            const Vector2 *bulletRing = GetDirectionRing(4);
+            Vector2 bulletSpin = DirectionFromAngle((FixedAngle)(completionRatio * (FIXED_ANGLE_TURN / 2)));
             for (int i = 0; i < 4; i++) {
-                float angle = i * PI/2.0f + completionRatio * PI;
+                Vector2 offset = RotateDirection(bulletRing[i], bulletSpin);
                 float distance = radius * completionRatio * 3.0f;
                 
                 Vector2 bulletPos = {
-                    pos.x + cosf(angle) * distance,
-                    pos.y + sinf(angle) * distance
+                    pos.x + offset.x * distance,
+                    pos.y + offset.y * distance
                 };
                 
                 DrawPixelCircleV(bulletPos, radius * 0.2f * (1.0f - completionRatio), 
@@ -1078,27 +1327,12 @@ void DrawPlayAreaBorder(void) {
 }
 
 
-void DrawTutorialScreen(void) {
-    ClearBackground(BLACK);
-    
-    
-    static float animTime = 0.0f;
-    animTime += GetFrameTime();
-    float pulse = 0.7f + sinf(animTime * 1.5f) * 0.2f;
-    
-    
-    const char *title = "TUTORIAL";
-    int titleWidth = MeasureText(title, 60);
-    DrawText(title, 
-             GetScreenWidth()/2 - titleWidth/2, 
-             60, 
-             60, 
-             Fade(WHITE, pulse));
-    
-    
-    DrawPlayAreaBorder();
-    
-    
+// Posições dos elementos animados do tutorial, calculadas junto com o layout fixo
+static int tutorialIconY[3];
+static int tutorialStartY;
+
+// Textos fixos do tutorial (desenhados uma vez na camada em cache)
+static void drawTutorialText(void) {
     int startY = 150;
     int lineHeight = 40;
     int sectionSpacing = 30;
@@ -1124,7 +1358,7 @@ void DrawTutorialScreen(void) {
     currentY += lineHeight;
     
     
-    DrawPixelCircle(GetScreenWidth()/2 - 300, currentY + 10, 15 * pulse, RED);
+    tutorialIconY[0] = currentY + 10;
     DrawText("Dano Aumentado: Projéteis maiores e mais fortes (custa 1 vida)", 
              GetScreenWidth()/2 - 270, 
              currentY, 
@@ -1133,7 +1367,7 @@ void DrawTutorialScreen(void) {
     currentY += lineHeight;
     
     
-    DrawPixelCircle(GetScreenWidth()/2 - 300, currentY + 10, 15 * pulse, GREEN);
+    tutorialIconY[1] = currentY + 10;
     DrawText("Cura: Recupera todas as vidas", 
              GetScreenWidth()/2 - 270, 
              currentY, 
@@ -1142,7 +1376,7 @@ void DrawTutorialScreen(void) {
     currentY += lineHeight;
     
     
-    DrawPixelCircle(GetScreenWidth()/2 - 300, currentY + 10, 15 * pulse, BLUE);
+    tutorialIconY[2] = currentY + 10;
     DrawText("Escudo: repele um projétil", 
              GetScreenWidth()/2 - 270, 
              currentY, 
@@ -1175,13 +1409,50 @@ void DrawTutorialScreen(void) {
              textColor);
     currentY += lineHeight + sectionSpacing * 2;
     
+    tutorialStartY = currentY;
+}
+
+
+void DrawTutorialScreen(void) {
+    ClearBackground(BLACK);
+    
+    
+    static float animTime = 0.0f;
+    animTime += GetFrameTime();
+    float pulse = 0.7f + sinf(animTime * 1.5f) * 0.2f;
+    
+    
+    const char *title = "TUTORIAL";
+    int titleWidth = MeasureCachedText(title, 60);
+    DrawCachedText(title, 
+                   GetScreenWidth()/2 - titleWidth/2, 
+                   60, 
+                   60, 
+                   Fade(WHITE, pulse));
+    
+    
+    DrawPlayAreaBorder();
+    
+    
+    // Textos fixos vêm da camada em cache; só os ícones e o convite são redesenhados
+    if (BeginScreenCache(SCREEN_CACHE_TUTORIAL, 0)) {
+        drawTutorialText();
+        EndScreenCache();
+    }
+    DrawScreenCache(SCREEN_CACHE_TUTORIAL, 1.0f);
+    
+    
+    DrawPixelCircle(GetScreenWidth()/2 - 300, tutorialIconY[0], 15 * pulse, RED);
+    DrawPixelCircle(GetScreenWidth()/2 - 300, tutorialIconY[1], 15 * pulse, GREEN);
+    DrawPixelCircle(GetScreenWidth()/2 - 300, tutorialIconY[2], 15 * pulse, BLUE);
+    
     
     const char *startText = "PRESS SPACE TO START GAME";
-    DrawText(startText, 
-             GetScreenWidth()/2 - MeasureText(startText, 30)/2, 
-             currentY, 
-             30, 
-             Fade(RED, 0.5f + sinf(animTime * 5.0f) * 0.5f));
+    DrawCachedText(startText, 
+                   GetScreenWidth()/2 - MeasureCachedText(startText, 30)/2, 
+                   tutorialStartY, 
+                   30, 
+                   Fade(RED, 0.5f + sinf(animTime * 5.0f) * 0.5f));
     
     
     DrawMinimalistCursor();
@@ -1206,20 +1477,26 @@ void DrawHUD(long score, int enemyCount, int playerLives) {
     
     scoreFlash = scoreFlash > 0.0f ? scoreFlash - GetFrameTime() * 2.0f : 0.0f;
     
-    const char* scoreText = TextFormat("%ld", score);
+    // Só reformatar quando o valor muda; o texto montado fica no cache
+    static long formattedScore = -1;
+    static char scoreText[24];
+    if (score != formattedScore) {
+        snprintf(scoreText, sizeof(scoreText), "%ld", score);
+        formattedScore = score;
+    }
     Color scoreColor = WHITE;
     
     if (scoreFlash > 0.0f) {
         scoreColor = Fade(WHITE, 0.7f + scoreFlash * 0.3f); 
     }
     
-    DrawPixelText(scoreText, centerX - MeasureText(scoreText, 38)/2, 15, 38, scoreColor);
-    DrawPixelText("SCORE", centerX - MeasureText("SCORE", 16)/2, 45, 16, Fade(LIGHTGRAY, 0.6f));
+    DrawPixelText(scoreText, centerX - MeasureCachedText(scoreText, 38)/2, 15, 38, scoreColor);
+    DrawPixelText("SCORE", centerX - MeasureCachedText("SCORE", 16)/2, 45, 16, Fade(LIGHTGRAY, 0.6f));
     
     // ===== VIDAS (CORAÇÕES) =====
     DrawPixelText("LIVES", 20, 24, 30, Fade(WHITE, 0.9f));
     
-    int livesTextWidth = MeasureText("LIVES", 30);
+    int livesTextWidth = MeasureCachedText("LIVES", 30);
     DrawPixelRect(30 + livesTextWidth, 20, 3 * 42 + 10, 28, Fade(WHITE, 0.15f));
     
     static float heartPulse = 0.0f;
@@ -1250,13 +1527,18 @@ void DrawHUD(long score, int enemyCount, int playerLives) {
     }
     
     // ===== CONTAGEM DE INIMIGOS =====
-    const char* enemiesText = TextFormat("%d", enemyCount);
-    int textWidth = MeasureText(enemiesText, 28);
+    static int formattedCount = -1;
+    static char enemiesText[16];
+    if (enemyCount != formattedCount) {
+        snprintf(enemiesText, sizeof(enemiesText), "%d", enemyCount);
+        formattedCount = enemyCount;
+    }
+    int textWidth = MeasureCachedText(enemiesText, 28);
     int rightAlign = GetScreenWidth() - 20 - textWidth;
     
     DrawPixelText(enemiesText, rightAlign, 20, 28, Fade(WHITE, 0.9f));
     DrawPixelCircle(rightAlign - 20, 30, 8, Fade(RED, 0.7f)); 
-    DrawPixelText("ENEMIES", GetScreenWidth() - MeasureText("ENEMIES", 16) - 20, 45, 16, Fade(LIGHTGRAY, 0.6f));
+    DrawPixelText("ENEMIES", GetScreenWidth() - MeasureCachedText("ENEMIES", 16) - 20, 45, 16, Fade(LIGHTGRAY, 0.6f));
     
     // Linha separadora na parte inferior
     for (int x = 0; x < GetScreenWidth(); x += 2) {
@@ -1333,12 +1615,12 @@ void DrawPauseMenu(void) {
     
     // Título
     const char *title = "PAUSA";
-    int titleWidth = MeasureText(title, 60);
-    DrawText(title, 
-             GetScreenWidth()/2 - titleWidth/2, 
-             GetScreenHeight()/4, 
-             60, 
-             Fade(WHITE, pulse));
+    int titleWidth = MeasureCachedText(title, 60);
+    DrawCachedText(title, 
+                   GetScreenWidth()/2 - titleWidth/2, 
+                   GetScreenHeight()/4, 
+                   60, 
+                   Fade(WHITE, pulse));
     
     
     int startY = GetScreenHeight()/2;
@@ -1353,23 +1635,23 @@ void DrawPauseMenu(void) {
     float menuPulse = 0.6f + sinf(animTime * 2.0f + 0.5f) * 0.4f;
     float restartPulse = 0.6f + sinf(animTime * 2.0f + 1.0f) * 0.4f;
     
-    DrawText(resumeText, 
-            GetScreenWidth()/2 - MeasureText(resumeText, 24)/2, 
-            startY, 
-            24, 
-            Fade(GREEN, resumePulse));
+    DrawCachedText(resumeText, 
+                   GetScreenWidth()/2 - MeasureCachedText(resumeText, 24)/2, 
+                   startY, 
+                   24, 
+                   Fade(GREEN, resumePulse));
     
-    DrawText(menuText, 
-            GetScreenWidth()/2 - MeasureText(menuText, 24)/2, 
-            startY + lineHeight, 
-            24, 
-            Fade(WHITE, menuPulse));
+    DrawCachedText(menuText, 
+                   GetScreenWidth()/2 - MeasureCachedText(menuText, 24)/2, 
+                   startY + lineHeight, 
+                   24, 
+                   Fade(WHITE, menuPulse));
     
-    DrawText(restartText, 
-            GetScreenWidth()/2 - MeasureText(restartText, 24)/2, 
-            startY + lineHeight * 2, 
-            24, 
-            Fade(RED, restartPulse));
+    DrawCachedText(restartText, 
+                   GetScreenWidth()/2 - MeasureCachedText(restartText, 24)/2, 
+                   startY + lineHeight * 2, 
+                   24, 
+                   Fade(RED, restartPulse));
     
     
     DrawPlayAreaBorder();
@@ -1388,8 +1670,8 @@ void DrawGameSummary(long score, int kills, float gameTime) {
 
     
     const char *title = "RESUMO DA PARTIDA";
-    DrawText(title, 
-             GetScreenWidth()/2 - MeasureText(title, 40)/2, 
+    DrawCachedText(title, 
+             GetScreenWidth()/2 - MeasureCachedText(title, 40)/2, 
              GetScreenHeight()/5, 
              40, 
              WHITE);
@@ -1402,8 +1684,8 @@ void DrawGameSummary(long score, int kills, float gameTime) {
     
     char scoreText[64];
     sprintf(scoreText, "PONTUAÇÃO: %ld", score);
-    DrawText(scoreText, 
-             centerX - MeasureText(scoreText, 30)/2, 
+    DrawCachedText(scoreText, 
+             centerX - MeasureCachedText(scoreText, 30)/2, 
              startY, 
              30, 
              RED);
@@ -1411,8 +1693,8 @@ void DrawGameSummary(long score, int kills, float gameTime) {
     
     char killsText[64];
     sprintf(killsText, "INIMIGOS ELIMINADOS: %d", kills);
-    DrawText(killsText, 
-             centerX - MeasureText(killsText, 30)/2, 
+    DrawCachedText(killsText, 
+             centerX - MeasureCachedText(killsText, 30)/2, 
              startY + lineHeight, 
              30, 
              WHITE);
@@ -1420,27 +1702,27 @@ void DrawGameSummary(long score, int kills, float gameTime) {
     
     char timeText[64];
     sprintf(timeText, "TEMPO DE JOGO: %s", FormatTime(gameTime));
-    DrawText(timeText, 
-             centerX - MeasureText(timeText, 30)/2, 
+    DrawCachedText(timeText, 
+             centerX - MeasureCachedText(timeText, 30)/2, 
              startY + 2 * lineHeight, 
              30, 
              WHITE);
     
     
-    DrawText("Pressione R para jogar novamente", 
-             centerX - MeasureText("Pressione R para jogar novamente", 20)/2, 
+    DrawCachedText("Pressione R para jogar novamente", 
+             centerX - MeasureCachedText("Pressione R para jogar novamente", 20)/2, 
              startY + 4 * lineHeight, 
              20, 
              GRAY);
     
-    DrawText("Pressione S para salvar no ranking", 
-             centerX - MeasureText("Pressione S para salvar no ranking", 20)/2, 
+    DrawCachedText("Pressione S para salvar no ranking", 
+             centerX - MeasureCachedText("Pressione S para salvar no ranking", 20)/2, 
              startY + 5 * lineHeight, 
              20, 
              GRAY);
     
-    DrawText("Pressione M para voltar ao menu", 
-             centerX - MeasureText("Pressione M para voltar ao menu", 20)/2, 
+    DrawCachedText("Pressione M para voltar ao menu", 
+             centerX - MeasureCachedText("Pressione M para voltar ao menu", 20)/2, 
              startY + 6 * lineHeight, 
              20, 
              GRAY);
@@ -1464,80 +1746,89 @@ void DrawNameEntryScreen(Game *game) {
     const char *title = "NOVO RECORDE!";
     int titleFontSize = 50;
     int titleY = GetScreenHeight() * 0.1f;
-    DrawText(title, 
-             GetScreenWidth()/2 - MeasureText(title, titleFontSize)/2, 
-             titleY, 
-             titleFontSize, 
-             Fade(RED, pulse));
+    DrawCachedText(title, 
+                   GetScreenWidth()/2 - MeasureCachedText(title, titleFontSize)/2, 
+                   titleY, 
+                   titleFontSize, 
+                   Fade(RED, pulse));
 
     
     const char *subtitle = "Digite seu nome para o ranking";
     int subtitleFontSize = 25;
     int subtitleY = titleY + titleFontSize + 15;
-    DrawText(subtitle,
-             GetScreenWidth()/2 - MeasureText(subtitle, subtitleFontSize)/2,
-             subtitleY,
-             subtitleFontSize,
-             WHITE);
 
     
     int boxWidth = 500;
     int boxHeight = 60;
     int boxX = GetScreenWidth()/2 - boxWidth/2;
     int boxY = subtitleY + 60;
+    
+    int scoreFontSize = 30;
+    int scoreY = boxY + boxHeight + 40;
+    int statsY = scoreY + scoreFontSize + 20;
+
+    
+    // Subtítulo, fundo da caixa e resumo da partida não mudam enquanto o nome
+    // é digitado: ficam na camada em cache, invalidada ao entrar nesta tela
+    if (BeginScreenCache(SCREEN_CACHE_NAME_ENTRY, 0)) {
+        DrawText(subtitle,
+                 GetScreenWidth()/2 - MeasureText(subtitle, subtitleFontSize)/2,
+                 subtitleY,
+                 subtitleFontSize,
+                 WHITE);
+        
+        DrawRectangle(boxX, boxY, boxWidth, boxHeight, Fade(DARKGRAY, 0.7f));
+        
+        char scoreText[64];
+        sprintf(scoreText, "PONTUAÇÃO: %ld", game->score);
+        DrawText(scoreText, 
+                 GetScreenWidth()/2 - MeasureText(scoreText, scoreFontSize)/2, 
+                 scoreY, 
+                 scoreFontSize, 
+                 RED);
+        
+        char statsText[100];
+        sprintf(statsText, "Inimigos eliminados: %d | Tempo de jogo: %s", 
+                game->enemiesKilled, FormatTime(game->gameTime));
+        DrawText(statsText, 
+                 GetScreenWidth()/2 - MeasureText(statsText, 20)/2, 
+                 statsY, 
+                 20, 
+                 GRAY);
+        
+        EndScreenCache();
+    }
+    DrawScreenCache(SCREEN_CACHE_NAME_ENTRY, 1.0f);
 
     
-    DrawRectangle(boxX, boxY, boxWidth, boxHeight, Fade(DARKGRAY, 0.7f));
     DrawRectangleLinesEx((Rectangle){boxX, boxY, boxWidth, boxHeight}, 
                          3, Fade(RED, pulse));
 
     
     int nameFontSize = 35;
-    DrawText(game->playerName, 
-             boxX + 20, 
-             boxY + (boxHeight - nameFontSize)/2, 
-             nameFontSize, 
-             WHITE);
+    DrawCachedText(game->playerName, 
+                   boxX + 20, 
+                   boxY + (boxHeight - nameFontSize)/2, 
+                   nameFontSize, 
+                   WHITE);
 
     
-    int nameWidth = MeasureText(game->playerName, nameFontSize);
+    int nameWidth = MeasureCachedText(game->playerName, nameFontSize);
     if ((int)(GetTime() * 2) % 2 == 0) {
-        DrawText("|", 
-                 boxX + 20 + nameWidth, 
-                 boxY + (boxHeight - nameFontSize)/2, 
-                 nameFontSize, 
-                 WHITE);
+        DrawCachedText("|", 
+                       boxX + 20 + nameWidth, 
+                       boxY + (boxHeight - nameFontSize)/2, 
+                       nameFontSize, 
+                       WHITE);
     }
 
     
-    char scoreText[64];
-    sprintf(scoreText, "PONTUAÇÃO: %ld", game->score);
-    int scoreFontSize = 30;
-    int scoreY = boxY + boxHeight + 40;
-    DrawText(scoreText, 
-             GetScreenWidth()/2 - MeasureText(scoreText, scoreFontSize)/2, 
-             scoreY, 
-             scoreFontSize, 
-             RED);
-    
-    
-    char statsText[100];
-    sprintf(statsText, "Inimigos eliminados: %d | Tempo de jogo: %s", 
-            game->enemiesKilled, FormatTime(game->gameTime));
-    int statsY = scoreY + scoreFontSize + 20;
-    DrawText(statsText, 
-             GetScreenWidth()/2 - MeasureText(statsText, 20)/2, 
-             statsY, 
-             20, 
-             GRAY);
-
-    
     const char *instruction = "Pressione ENTER para confirmar";
-    DrawText(instruction, 
-             GetScreenWidth()/2 - MeasureText(instruction, 25)/2,
-             GetScreenHeight() - 80, 
-             25, 
-             Fade(RED, 0.5f + sinf(animTime * 4) * 0.5f));
+    DrawCachedText(instruction, 
+                   GetScreenWidth()/2 - MeasureCachedText(instruction, 25)/2,
+                   GetScreenHeight() - 80, 
+                   25, 
+                   Fade(RED, 0.5f + sinf(animTime * 4) * 0.5f));
 
     
     DrawMinimalistCursor();
@@ -1551,67 +1842,101 @@ void RenderScoreboardScreen(void) {
     DrawPlayAreaBorder();
     
     
-    const char *title = "MELHORES PONTUAÇÕES";
-    DrawText(title, 
-             GetScreenWidth()/2 - MeasureText(title, 40)/2, 
-             50, 
-             40, 
-             WHITE);
-    
-    
-    int columnHeaderY = 120;
-    DrawText("POSIÇÃO", GetScreenWidth()/2 - 250, columnHeaderY, 20, GRAY);
-    DrawText("NOME", GetScreenWidth()/2 - 100, columnHeaderY, 20, GRAY);
-    DrawText("PONTUAÇÃO", GetScreenWidth()/2 + 100, columnHeaderY, 20, GRAY);
-    
-    
-    DrawLine(GetScreenWidth()/2 - 300, columnHeaderY + 30, 
-             GetScreenWidth()/2 + 300, columnHeaderY + 30, 
-             Fade(GRAY, 0.5));
-    
-    
-    int startY = columnHeaderY + 50;
-    int entryHeight = 40;
-    
-    int scoreCount = GetScoreCount();
-    for (int i = 0; i < scoreCount && i < MAX_SCORES; i++) {
-        ScoreEntry score = GetScoreAt(i);
+    // Título, cabeçalhos e entradas só mudam quando o ranking ou a ordenação
+    // mudam; fora disso a tela inteira vem da camada em cache
+    if (BeginScreenCache(SCREEN_CACHE_SCOREBOARD, GetScoreboardVersion())) {
+        const char *title = "MELHORES PONTUAÇÕES";
+        DrawText(title, 
+                 GetScreenWidth()/2 - MeasureText(title, 40)/2, 
+                 50, 
+                 40, 
+                 WHITE);
         
         
-        char posText[10];
-        sprintf(posText, "%dº", i + 1);
-        DrawText(posText, 
-                 GetScreenWidth()/2 - 250, 
-                 startY + i * entryHeight, 
-                 25, 
-                 WHITE);
+        int columnHeaderY = 120;
+        DrawText("POSIÇÃO", GetScreenWidth()/2 - 250, columnHeaderY, 20, GRAY);
+        DrawText("NOME", GetScreenWidth()/2 - 100, columnHeaderY, 20, GRAY);
+        SortType view = GetScoreboardView();
+        const char *valueHeader = (view == SORT_BY_KILLS) ? "KILLS" :
+                                  (view == SORT_BY_TIME) ? "TEMPO" : "PONTUAÇÃO";
+        DrawText(valueHeader, GetScreenWidth()/2 + 100, columnHeaderY, 20, GRAY);
         
         
-        DrawText(score.name, 
-                 GetScreenWidth()/2 - 100, 
-                 startY + i * entryHeight, 
-                 25, 
-                 WHITE);
+        DrawLine(GetScreenWidth()/2 - 300, columnHeaderY + 30, 
+                 GetScreenWidth()/2 + 300, columnHeaderY + 30, 
+                 Fade(GRAY, 0.5));
         
         
-        char scoreText[20];
-        sprintf(scoreText, "%ld", score.score);
-        DrawText(scoreText, 
-                 GetScreenWidth()/2 + 100, 
-                 startY + i * entryHeight, 
-                 25, 
-                 WHITE);
+        int startY = columnHeaderY + 50;
+        int entryHeight = 40;
+        
+        int scoreCount = GetScoreCount();
+        for (int i = 0; i < scoreCount && i < MAX_SCORES; i++) {
+            ScoreEntry score = GetScoreAt(i);
+            
+            
+            char posText[10];
+            sprintf(posText, "%dº", i + 1);
+            DrawText(posText, 
+                     GetScreenWidth()/2 - 250, 
+                     startY + i * entryHeight, 
+                     25, 
+                     WHITE);
+            
+            
+            DrawText(score.name, 
+                     GetScreenWidth()/2 - 100, 
+                     startY + i * entryHeight, 
+                     25, 
+                     WHITE);
+            
+            
+            char scoreText[20];
+            if (view == SORT_BY_KILLS) {
+                sprintf(scoreText, "%d", score.kills);
+            } else if (view == SORT_BY_TIME) {
+                sprintf(scoreText, "%s", FormatTime(score.gameTime));
+            } else {
+                sprintf(scoreText, "%ld", score.score);
+            }
+            DrawText(scoreText, 
+                     GetScreenWidth()/2 + 100, 
+                     startY + i * entryHeight, 
+                     25, 
+                     WHITE);
+        }
+        
+        EndScreenCache();
+    }
+    DrawScreenCache(SCREEN_CACHE_SCOREBOARD, 1.0f);
+    
+    
+    // Estado da gravação em segundo plano
+    const char *saveText = NULL;
+    Color saveColor = GRAY;
+    switch (GetScoreSaveStatus()) {
+        case SCORE_SAVE_PENDING: saveText = "Salvando..."; break;
+        case SCORE_SAVE_DONE:    saveText = "Pontuação salva"; saveColor = GREEN; break;
+        case SCORE_SAVE_FAILED:  saveText = "Falha ao salvar a pontuação"; saveColor = RED; break;
+        default: break;
+    }
+    if (saveText != NULL) {
+        DrawCachedText(saveText, 
+                       GetScreenWidth()/2 - MeasureCachedText(saveText, 20)/2, 
+                       GetScreenHeight() - 90, 
+                       20, 
+                       Fade(saveColor, 0.8f));
     }
     
     
     static float time = 0;
     time += GetFrameTime();
-    const char *instruction = "Pressione M para voltar ao menu";
-    DrawText(instruction, 
-             GetScreenWidth()/2 - MeasureText(instruction, 20)/2, 
-             GetScreenHeight() - 50, 
-             20, 
-             Fade(RED, 0.5f + sinf(time * 3.0f) * 0.5f));
+    const char *instruction = "Pressione M para voltar ao menu  |  ESQ/DIR muda a ordenação";
+    DrawCachedText(instruction, 
+                   GetScreenWidth()/2 - MeasureCachedText(instruction, 20)/2, 
+                   GetScreenHeight() - 50, 
+                   20, 
+                   Fade(RED, 0.5f + sinf(time * 3.0f) * 0.5f));
     
     
     DrawMinimalistCursor();
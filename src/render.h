@@ -16,7 +16,7 @@ void DrawPixelLine(float x1, float y1, float x2, float y2, Color color);
 void DrawPlayAreaBorder(void);
 
 
-void DrawGameplay(const Player *player, const EnemyList *enemies, const Bullet *bullets, const Bullet *enemyBullets, const Powerup *powerups, long score);
+void DrawGameplay(const Player *player, const EnemyList *enemies, const BulletList *bullets, const BulletList *enemyBullets, const PowerupStore *powerups, const Boss *boss, long score);
 void DrawGameOverScreen(long finalScore);
 void DrawMainMenu(void);
 void DrawMinimalistCursor(void);
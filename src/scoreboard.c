@@ -1,200 +1,706 @@
+#if !defined(_WIN32)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
 #include "scoreboard.h"
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
+#include <pthread.h>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#else
+#include <io.h>
+#endif
+
+
+// Histórico completo de partidas (log só de acréscimo em disco) e, para cada
+// critério de ordenação, os índices das MAX_SCORES melhores partidas.
+// Inserir custa uma busca binária por critério; salvar custa um registro.
+static ScoreEntry *runs = NULL;
+static int runCount = 0;
+static int runCapacity = 0;
+
+static int topRuns[SORT_TYPE_COUNT][MAX_SCORES];
+static int topCount[SORT_TYPE_COUNT] = {0};
+
+static SortType activeSortType = SORT_BY_SCORE;
+static int newRunIndex = -1;
+// Incrementada a cada mudança no que a tela de ranking mostra (cache da tela)
+static unsigned int scoreboardVersion = 0;
+
+
+// true se a partida a deve aparecer antes da partida b no critério dado.
+// Empates mantêm a partida mais antiga na frente.
+static bool ranksBefore(const ScoreEntry *a, const ScoreEntry *b, SortType sortType) {
+    switch (sortType) {
+        case SORT_BY_KILLS: return a->kills > b->kills;
+        case SORT_BY_TIME:  return a->gameTime < b->gameTime;
+        case SORT_BY_SCORE:
+        default:            return a->score > b->score;
+    }
+}
+
+// Posição em que a partida entraria no top do critério (busca binária)
+static int findTopPosition(SortType sortType, const ScoreEntry *entry) {
+    int low = 0;
+    int high = topCount[sortType];
+    
+    while (low < high) {
+        int mid = (low + high) / 2;
+        if (ranksBefore(entry, &runs[topRuns[sortType][mid]], sortType)) {
+            high = mid;
+        } else {
+            low = mid + 1;
+        }
+    }
+    
+    return low;
+}
+
+static void indexRun(int runIndex) {
+    for (int key = 0; key < SORT_TYPE_COUNT; key++) {
+        int position = findTopPosition(key, &runs[runIndex]);
+        if (position >= MAX_SCORES) continue;
+        
+        int last = topCount[key] < MAX_SCORES ? topCount[key] : MAX_SCORES - 1;
+        memmove(&topRuns[key][position + 1], &topRuns[key][position], 
+                (last - position) * sizeof(int));
+        topRuns[key][position] = runIndex;
+        
+        if (topCount[key] < MAX_SCORES) topCount[key]++;
+    }
+}
+
+// Acrescenta a partida ao histórico em memória e atualiza os índices
+static int insertRun(const char *name, long score, int kills, float gameTime) {
+    if (runCount == runCapacity) {
+        int newCapacity = runCapacity ? runCapacity * 2 : 64;
+        ScoreEntry *grown = realloc(runs, newCapacity * sizeof(ScoreEntry));
+        if (grown == NULL) return -1;
+        runs = grown;
+        runCapacity = newCapacity;
+    }
+    
+    ScoreEntry *entry = &runs[runCount];
+    memset(entry, 0, sizeof(ScoreEntry));
+    strncpy(entry->name, name, MAX_NAME_LENGTH - 1);
+    entry->score = score;
+    entry->kills = kills;
+    entry->gameTime = gameTime;
+    entry->isNew = false;
+    
+    indexRun(runCount);
+    scoreboardVersion++;
+    return runCount++;
+}
+
+static void clearRuns(void) {
+    free(runs);
+    runs = NULL;
+    runCount = 0;
+    runCapacity = 0;
+    newRunIndex = -1;
+    for (int key = 0; key < SORT_TYPE_COUNT; key++) {
+        topCount[key] = 0;
+    }
+    scoreboardVersion++;
+}
 
+// ===== Formato do arquivo =====
+// Cabeçalho (16 bytes): "MAGR" | versão (u16) | tamanho do registro (u16) |
+//                       reservado (u32) | CRC32 dos 12 bytes anteriores (u32)
+// Registro (72 bytes):  nome[50] | 2 bytes de preenchimento | pontuação (i64) |
+//                       kills (i32) | tempo (f32) | CRC32 dos 68 bytes anteriores (u32)
+// Tudo em little-endian e com larguras fixas, independente da plataforma.
+// Um registro que falha no CRC é pulado e só ele se perde; um registro cortado
+// no fim (escrita interrompida) é descartado. Antes de regravar o arquivo limpo,
+// o original é copiado para runs.log.bak. Com o cabeçalho corrompido o original
+// vai para runs.log.corrupt e o histórico é refeito com os registros cujo
+// próprio CRC confere; só uma versão mais nova deixa o arquivo intocado.
+
+#define SCORE_FILE_MAGIC "MAGR"
+#define SCORE_FILE_VERSION 1
+#define SCORE_HEADER_SIZE 16
+#define SCORE_RECORD_SIZE 72
+#define SCORE_RECORD_PAYLOAD (SCORE_RECORD_SIZE - 4)
+#define SCORE_TEMP_SUFFIX ".tmp"
+#define SCORE_BACKUP_SUFFIX ".bak"
+#define SCORE_CORRUPT_SUFFIX ".corrupt"
+
+// Falso quando o arquivo é de uma versão mais nova: nada é escrito por cima
+static bool scoreFileWritable = true;
+
+
+static uint32_t crcTable[256];
+static bool crcTableReady = false;
+
+static uint32_t computeCrc32(const unsigned char *data, size_t length) {
+    if (!crcTableReady) {
+        for (uint32_t n = 0; n < 256; n++) {
+            uint32_t c = n;
+            for (int k = 0; k < 8; k++) {
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            }
+            crcTable[n] = c;
+        }
+        crcTableReady = true;
+    }
+    
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < length; i++) {
+        crc = crcTable[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFFu;
+}
 
-int GetScorePosition(long score);
+static void putU16(unsigned char *out, uint16_t value) {
+    out[0] = value & 0xFF;
+    out[1] = (value >> 8) & 0xFF;
+}
 
+static void putU32(unsigned char *out, uint32_t value) {
+    for (int i = 0; i < 4; i++) out[i] = (value >> (8 * i)) & 0xFF;
+}
+
+static void putU64(unsigned char *out, uint64_t value) {
+    for (int i = 0; i < 8; i++) out[i] = (value >> (8 * i)) & 0xFF;
+}
 
-static ScoreEntry scores[MAX_SCORES];
-static int scoreCount = 0;
+static uint16_t getU16(const unsigned char *in) {
+    return (uint16_t)(in[0] | (in[1] << 8));
+}
 
+static uint32_t getU32(const unsigned char *in) {
+    return (uint32_t)in[0] | ((uint32_t)in[1] << 8) | ((uint32_t)in[2] << 16) | ((uint32_t)in[3] << 24);
+}
 
-void InitScoreboard(void) {
-    LoadScoreboard();
+static uint64_t getU64(const unsigned char *in) {
+    uint64_t value = 0;
+    for (int i = 7; i >= 0; i--) value = (value << 8) | in[i];
+    return value;
 }
 
+static void encodeHeader(unsigned char *out) {
+    memset(out, 0, SCORE_HEADER_SIZE);
+    memcpy(out, SCORE_FILE_MAGIC, 4);
+    putU16(out + 4, SCORE_FILE_VERSION);
+    putU16(out + 6, SCORE_RECORD_SIZE);
+    putU32(out + 12, computeCrc32(out, 12));
+}
 
-void AddScore(const char *name, long score, int kills, float gameTime) {
-    if (scoreCount >= MAX_SCORES && score <= scores[scoreCount-1].score) {
-        
-        return;
-    }
+static void encodeRecord(unsigned char *out, const ScoreEntry *entry) {
+    memset(out, 0, SCORE_RECORD_SIZE);
+    memcpy(out, entry->name, MAX_NAME_LENGTH);
+    out[MAX_NAME_LENGTH - 1] = '\0';
     
+    uint32_t timeBits;
+    memcpy(&timeBits, &entry->gameTime, sizeof(timeBits));
     
-    int position = GetScorePosition(score);
+    putU64(out + 52, (uint64_t)(int64_t)entry->score);
+    putU32(out + 60, (uint32_t)entry->kills);
+    putU32(out + 64, timeBits);
+    putU32(out + SCORE_RECORD_PAYLOAD, computeCrc32(out, SCORE_RECORD_PAYLOAD));
+}
+
+static bool decodeRecord(const unsigned char *in, ScoreEntry *entry) {
+    if (getU32(in + SCORE_RECORD_PAYLOAD) != computeCrc32(in, SCORE_RECORD_PAYLOAD)) {
+        return false;
+    }
     
+    memcpy(entry->name, in, MAX_NAME_LENGTH);
+    entry->name[MAX_NAME_LENGTH - 1] = '\0';
+    entry->score = (long)(int64_t)getU64(in + 52);
+    entry->kills = (int32_t)getU32(in + 60);
     
-    if (scoreCount >= MAX_SCORES) {
-        scoreCount--;
+    uint32_t timeBits = getU32(in + 64);
+    memcpy(&entry->gameTime, &timeBits, sizeof(timeBits));
+    entry->isNew = false;
+    return true;
+}
+
+// Força os dados já escritos para o disco antes de fechar
+static bool syncAndClose(FILE *file, bool ok) {
+    ok = ok && fflush(file) == 0;
+#if !defined(_WIN32)
+    ok = ok && fsync(fileno(file)) == 0;
+#endif
+    return (fclose(file) == 0) && ok;
+}
+
+static bool writeRecords(FILE *file, const ScoreEntry *entries, int count) {
+    unsigned char record[SCORE_RECORD_SIZE];
+    for (int i = 0; i < count; i++) {
+        encodeRecord(record, &entries[i]);
+        if (fwrite(record, 1, SCORE_RECORD_SIZE, file) != SCORE_RECORD_SIZE) return false;
     }
+    return true;
+}
+
+// Grava o arquivo inteiro de forma atômica: escreve em um temporário,
+// força para o disco e só então substitui o original com rename
+static bool writeScoreFile(const ScoreEntry *entries, int count) {
+    if (!scoreFileWritable) return false;
     
+    char tempPath[64];
+    snprintf(tempPath, sizeof(tempPath), "%s%s", SCORE_LOG_FILE, SCORE_TEMP_SUFFIX);
     
-    for (int i = scoreCount; i > position; i--) {
-        scores[i] = scores[i-1];
+    FILE *file = fopen(tempPath, "wb");
+    if (file == NULL) {
+        return false;
     }
     
+    unsigned char header[SCORE_HEADER_SIZE];
+    encodeHeader(header);
+    bool ok = fwrite(header, 1, SCORE_HEADER_SIZE, file) == SCORE_HEADER_SIZE;
+    ok = ok && writeRecords(file, entries, count);
     
-    strncpy(scores[position].name, name, MAX_NAME_LENGTH-1);
-    scores[position].name[MAX_NAME_LENGTH-1] = '\0'; 
-    scores[position].score = score;
-    scores[position].kills = kills;         
-    scores[position].gameTime = gameTime;   
-    scores[position].isNew = true;
-    
+    if (!syncAndClose(file, ok)) {
+        remove(tempPath);
+        return false;
+    }
     
-    if (scoreCount < MAX_SCORES) {
-        scoreCount++;
+#if defined(_WIN32)
+    remove(SCORE_LOG_FILE);  // rename no Windows não substitui um arquivo existente
+#endif
+    if (rename(tempPath, SCORE_LOG_FILE) != 0) {
+        remove(tempPath);
+        return false;
     }
     
+    return true;
+}
+
+static bool rewriteScoreFile(void) {
+    return writeScoreFile(runs, runCount);
+}
+
+// Cópia byte a byte do arquivo como foi lido, feita antes de qualquer reparo
+static bool writeScoreFileCopy(const unsigned char *data, size_t size, const char *suffix) {
+    char copyPath[64];
+    snprintf(copyPath, sizeof(copyPath), "%s%s", SCORE_LOG_FILE, suffix);
+    
+    FILE *file = fopen(copyPath, "wb");
+    if (file == NULL) {
+        return false;
+    }
     
-    SortScoreboard(SORT_BY_SCORE);  
-    SaveScoreboard();
+    return syncAndClose(file, fwrite(data, 1, size, file) == size);
+}
+
+static long scoreFileSize(FILE *file) {
+#if defined(_WIN32)
+    if (fseek(file, 0, SEEK_END) != 0) return -1;
+    return ftell(file);
+#else
+    struct stat info;
+    if (fstat(fileno(file), &info) != 0) return -1;
+    return (long)info.st_size;
+#endif
 }
 
+static bool truncateScoreFile(FILE *file, long size) {
+#if defined(_WIN32)
+    return _chsize(_fileno(file), size) == 0;
+#else
+    return ftruncate(fileno(file), (off_t)size) == 0;
+#endif
+}
 
-int Partition(ScoreEntry arr[], int low, int high) {
-    long pivot = arr[high].score;
-    int i = (low - 1);
+// Acrescenta um lote de registros ao fim do log com um único fsync
+static bool appendRunsToLog(const ScoreEntry *entries, int count) {
+    if (!scoreFileWritable) return false;
     
-    for (int j = low; j <= high - 1; j++) {
-        
-        if (arr[j].score > pivot) {
-            i++;
-            
-            ScoreEntry temp = arr[i];
-            arr[i] = arr[j];
-            arr[j] = temp;
-        }
+    FILE *file = fopen(SCORE_LOG_FILE, "ab");
+    if (file == NULL) {
+        return false;
+    }
+    
+    long size = scoreFileSize(file);
+    if (size < 0) {
+        fclose(file);
+        return false;
     }
     
+    // Arquivo novo, vazio ou sem cabeçalho completo (a carga trata como
+    // ausente): recriar com cabeçalho, já incluindo o lote
+    if (size < SCORE_HEADER_SIZE) {
+        fclose(file);
+        return writeScoreFile(entries, count);
+    }
     
-    ScoreEntry temp = arr[i + 1];
-    arr[i + 1] = arr[high];
-    arr[high] = temp;
+    // Um acréscimo anterior falhou no meio: voltar ao último registro inteiro,
+    // senão todos os registros seguintes ficam desalinhados
+    long partial = (size - SCORE_HEADER_SIZE) % SCORE_RECORD_SIZE;
+    if (partial != 0 && !truncateScoreFile(file, size - partial)) {
+        fclose(file);
+        return false;
+    }
     
-    return (i + 1);
+    return syncAndClose(file, writeRecords(file, entries, count));
 }
 
 
-void QuickSort(ScoreEntry arr[], int low, int high) {
-    if (low < high) {
+// ===== Thread de persistência =====
+// AddScore só copia o registro para a fila; a thread grava lotes inteiros fora
+// do frame, então a latência do disco nunca aparece como frame perdido.
+static pthread_t saveThread;
+static pthread_mutex_t saveMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t saveWorkCond = PTHREAD_COND_INITIALIZER;   // há trabalho ou pedido de parada
+static pthread_cond_t saveIdleCond = PTHREAD_COND_INITIALIZER;   // a fila esvaziou
+
+static ScoreEntry *pendingRuns = NULL;    // preenchida pelo jogo
+static int pendingCount = 0;
+static int pendingCapacity = 0;
+static ScoreEntry *batchRuns = NULL;      // lote sendo gravado pela thread
+static int batchCapacity = 0;
+
+static bool saveThreadRunning = false;
+static bool saveThreadBusy = false;
+static bool saveStopRequested = false;
+static ScoreSaveStatus saveStatus = SCORE_SAVE_IDLE;
+
+static void *saveWorker(void *arg) {
+    (void)arg;
+    pthread_mutex_lock(&saveMutex);
+    
+    while (true) {
+        while (pendingCount == 0 && !saveStopRequested) {
+            pthread_cond_wait(&saveWorkCond, &saveMutex);
+        }
+        if (pendingCount == 0) break;
         
-        int pi = Partition(arr, low, high);
+        // Trocar os buffers: o jogo continua enfileirando enquanto o lote é gravado
+        ScoreEntry *batch = pendingRuns;
+        int batchCount = pendingCount;
+        int capacity = pendingCapacity;
+        pendingRuns = batchRuns;
+        pendingCapacity = batchCapacity;
+        pendingCount = 0;
+        batchRuns = batch;
+        batchCapacity = capacity;
+        saveThreadBusy = true;
         
+        pthread_mutex_unlock(&saveMutex);
+        bool ok = appendRunsToLog(batch, batchCount);
+        pthread_mutex_lock(&saveMutex);
         
-        QuickSort(arr, low, pi - 1);
-        QuickSort(arr, pi + 1, high);
+        saveThreadBusy = false;
+        if (!ok) {
+            saveStatus = SCORE_SAVE_FAILED;
+        } else if (pendingCount == 0 && saveStatus != SCORE_SAVE_FAILED) {
+            saveStatus = SCORE_SAVE_DONE;
+        }
+        pthread_cond_broadcast(&saveIdleCond);
+    }
+    
+    pthread_mutex_unlock(&saveMutex);
+    return NULL;
+}
+
+static void startSaveThread(void) {
+    if (saveThreadRunning) return;
+    
+    saveStopRequested = false;
+    saveThreadRunning = pthread_create(&saveThread, NULL, saveWorker, NULL) == 0;
+    if (!saveThreadRunning) {
+        printf("AVISO: thread de salvamento indisponível, gravando de forma síncrona\n");
     }
 }
 
+// Bloqueia até a thread gravar tudo que estava na fila
+static void waitForPendingSaves(void) {
+    if (!saveThreadRunning) return;
+    
+    pthread_mutex_lock(&saveMutex);
+    while (pendingCount > 0 || saveThreadBusy) {
+        pthread_cond_wait(&saveIdleCond, &saveMutex);
+    }
+    pthread_mutex_unlock(&saveMutex);
+}
 
-void SortScoreboard(SortType sortType) {
-    if (scoreCount <= 1) {
-        return;  
+static void queueRunForSave(const ScoreEntry *entry) {
+    if (!saveThreadRunning) {
+        saveStatus = appendRunsToLog(entry, 1) ? SCORE_SAVE_DONE : SCORE_SAVE_FAILED;
+        return;
     }
     
+    pthread_mutex_lock(&saveMutex);
     
-    for (int i = 0; i < scoreCount - 1; i++) {
-        for (int j = 0; j < scoreCount - i - 1; j++) {
-            bool shouldSwap = false;
-            
-            switch (sortType) {
-                case SORT_BY_SCORE:
-                    shouldSwap = scores[j].score < scores[j + 1].score;
-                    break;
-                case SORT_BY_KILLS:
-                    shouldSwap = scores[j].kills < scores[j + 1].kills;
-                    break;
-                case SORT_BY_TIME:
-                    
-                    shouldSwap = scores[j].gameTime > scores[j + 1].gameTime;
-                    break;
-            }
-            
-            if (shouldSwap) {
-                ScoreEntry temp = scores[j];
-                scores[j] = scores[j + 1];
-                scores[j + 1] = temp;
-            }
+    if (pendingCount == pendingCapacity) {
+        int newCapacity = pendingCapacity ? pendingCapacity * 2 : 8;
+        ScoreEntry *grown = realloc(pendingRuns, newCapacity * sizeof(ScoreEntry));
+        if (grown == NULL) {
+            saveStatus = SCORE_SAVE_FAILED;
+            pthread_mutex_unlock(&saveMutex);
+            return;
         }
+        pendingRuns = grown;
+        pendingCapacity = newCapacity;
     }
+    
+    pendingRuns[pendingCount++] = *entry;
+    saveStatus = SCORE_SAVE_PENDING;
+    
+    pthread_cond_signal(&saveWorkCond);
+    pthread_mutex_unlock(&saveMutex);
 }
 
 
-void SaveScoreboard(void) {
-    FILE *file = fopen("scores.dat", "wb");
+// Lê um registro no formato antigo (campos nativos, dependentes da plataforma)
+static bool readNativeRecord(FILE *file, ScoreEntry *entry) {
+    if (fread(entry->name, sizeof(char), MAX_NAME_LENGTH, file) != MAX_NAME_LENGTH) return false;
+    if (fread(&entry->score, sizeof(long), 1, file) != 1) return false;
+    if (fread(&entry->kills, sizeof(int), 1, file) != 1) return false;
+    if (fread(&entry->gameTime, sizeof(float), 1, file) != 1) return false;
+    entry->name[MAX_NAME_LENGTH - 1] = '\0';
+    return true;
+}
+
+// Importa o placar antigo (scores.dat, só top 10) na primeira execução
+static void importLegacyScoreboard(void) {
+    FILE *file = fopen(LEGACY_SCORE_FILE, "rb");
     if (file == NULL) {
-        return; 
+        return;
     }
     
+    int legacyCount = 0;
+    if (fread(&legacyCount, sizeof(int), 1, file) != 1) legacyCount = 0;
+    if (legacyCount < 0) legacyCount = 0;
+    if (legacyCount > MAX_SCORES) legacyCount = MAX_SCORES;
     
-    fwrite(&scoreCount, sizeof(int), 1, file);
+    for (int i = 0; i < legacyCount; i++) {
+        ScoreEntry entry;
+        if (!readNativeRecord(file, &entry)) break;
+        insertRun(entry.name, entry.score, entry.kills, entry.gameTime);
+    }
     
+    fclose(file);
     
-    for (int i = 0; i < scoreCount; i++) {
-        
-        fwrite(scores[i].name, sizeof(char), MAX_NAME_LENGTH, file);
-        fwrite(&scores[i].score, sizeof(long), 1, file);
-        fwrite(&scores[i].kills, sizeof(int), 1, file);
-        fwrite(&scores[i].gameTime, sizeof(float), 1, file);
+    if (runCount > 0) rewriteScoreFile();
+}
+
+// Mapeia (ou lê) o arquivo inteiro para validar e decodificar em uma passada
+static const unsigned char *openScoreFileData(size_t *size) {
+#if defined(_WIN32)
+    FILE *file = fopen(SCORE_LOG_FILE, "rb");
+    if (file == NULL) return NULL;
+    
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    
+    unsigned char *data = (length > 0) ? malloc(length) : NULL;
+    if (data == NULL || fread(data, 1, length, file) != (size_t)length) {
+        free(data);
+        fclose(file);
+        return NULL;
     }
     
     fclose(file);
+    *size = (size_t)length;
+    return data;
+#else
+    int fd = open(SCORE_LOG_FILE, O_RDONLY);
+    if (fd < 0) return NULL;
+    
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        close(fd);
+        return NULL;
+    }
+    
+    void *mapped = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED) return NULL;
+    
+    *size = (size_t)info.st_size;
+    return mapped;
+#endif
 }
 
+static void closeScoreFileData(const unsigned char *data, size_t size) {
+#if defined(_WIN32)
+    (void)size;
+    free((void *)data);
+#else
+    munmap((void *)data, size);
+#endif
+}
 
-void LoadScoreboard(void) {
-    FILE *file = fopen("scores.dat", "rb");
-    if (file == NULL) {
-        scoreCount = 0;
-        return; 
+
+void InitScoreboard(void) {
+    LoadScoreboard();
+    startSaveThread();
+}
+
+
+void ShutdownScoreboard(void) {
+    if (saveThreadRunning) {
+        // Gravar o que ainda estiver na fila antes de encerrar
+        pthread_mutex_lock(&saveMutex);
+        saveStopRequested = true;
+        pthread_cond_signal(&saveWorkCond);
+        pthread_mutex_unlock(&saveMutex);
+        
+        pthread_join(saveThread, NULL);
+        saveThreadRunning = false;
     }
     
+    free(pendingRuns);
+    free(batchRuns);
+    pendingRuns = batchRuns = NULL;
+    pendingCount = pendingCapacity = batchCapacity = 0;
     
-    fread(&scoreCount, sizeof(int), 1, file);
-    
+    clearRuns();
+}
+
+
+ScoreSaveStatus GetScoreSaveStatus(void) {
+    if (!saveThreadRunning) return saveStatus;
     
-    if (scoreCount > MAX_SCORES) {
-        scoreCount = MAX_SCORES;
+    pthread_mutex_lock(&saveMutex);
+    ScoreSaveStatus status = saveStatus;
+    pthread_mutex_unlock(&saveMutex);
+    return status;
+}
+
+
+void AddScore(const char *name, long score, int kills, float gameTime) {
+    int index = insertRun(name, score, kills, gameTime);
+    if (index < 0) {
+        return;
     }
     
+    if (newRunIndex >= 0) runs[newRunIndex].isNew = false;
+    runs[index].isNew = true;
+    newRunIndex = index;
     
-    for (int i = 0; i < scoreCount; i++) {
-        fread(scores[i].name, sizeof(char), MAX_NAME_LENGTH, file);
-        fread(&scores[i].score, sizeof(long), 1, file);
-        fread(&scores[i].kills, sizeof(int), 1, file);
-        fread(&scores[i].gameTime, sizeof(float), 1, file);
-        scores[i].isNew = false; 
+    // Salvamento incremental: só o novo registro vai para o disco, fora do frame
+    queueRunForSave(&runs[index]);
+}
+
+
+void SetScoreboardView(SortType sortType) {
+    // Os índices já estão ordenados; apenas escolher qual deles GetScoreAt lê
+    if (sortType >= 0 && sortType < SORT_TYPE_COUNT && sortType != activeSortType) {
+        activeSortType = sortType;
+        scoreboardVersion++;
+    }
+}
+
+
+void SaveScoreboard(void) {
+    // Reescreve (compacta) o log inteiro. O uso normal é o acréscimo feito em AddScore.
+    waitForPendingSaves();
+    rewriteScoreFile();
+}
+
+
+void LoadScoreboard(void) {
+    waitForPendingSaves();
+    clearRuns();
+    scoreFileWritable = true;
+    
+    size_t size = 0;
+    const unsigned char *data = openScoreFileData(&size);
+    if (data == NULL) {
+        // Sem histórico novo: importar o placar antigo, se houver
+        importLegacyScoreboard();
+        return; 
     }
     
-    fclose(file);
+    bool headerValid = size >= SCORE_HEADER_SIZE &&
+                       memcmp(data, SCORE_FILE_MAGIC, 4) == 0 &&
+                       getU32(data + 12) == computeCrc32(data, 12);
+    if (headerValid && getU16(data + 4) > SCORE_FILE_VERSION) {
+        // Versão futura: não sobrescrever o que esta versão não entende
+        printf("AVISO: %s é de uma versão mais nova, placar só para leitura\n", SCORE_LOG_FILE);
+        scoreFileWritable = false;
+        closeScoreFileData(data, size);
+        return;
+    }
+    // Cabeçalho estragado: os registros continuam no lugar e cada um tem o próprio CRC
+    bool corrupt = !headerValid || getU16(data + 6) != SCORE_RECORD_SIZE;
+    
+    // Validar e decodificar em uma única passada; um registro com CRC errado
+    // é pulado sem perder os que vêm depois dele
+    size_t body = (size > SCORE_HEADER_SIZE) ? size - SCORE_HEADER_SIZE : 0;
+    size_t recordCount = body / SCORE_RECORD_SIZE;
+    bool truncated = body % SCORE_RECORD_SIZE != 0;
+    int skipped = 0;
+    
+    const unsigned char *record = data + SCORE_HEADER_SIZE;
+    for (size_t i = 0; i < recordCount; i++, record += SCORE_RECORD_SIZE) {
+        ScoreEntry entry;
+        if (!decodeRecord(record, &entry)) {
+            skipped++;
+            continue;
+        }
+        insertRun(entry.name, entry.score, entry.kills, entry.gameTime);
+    }
+    
+    // Regravar só com os registros válidos, guardando antes o original
+    bool repair = corrupt || truncated || skipped > 0;
+    const char *copySuffix = corrupt ? SCORE_CORRUPT_SUFFIX : SCORE_BACKUP_SUFFIX;
+    bool copied = repair && writeScoreFileCopy(data, size, copySuffix);
+    closeScoreFileData(data, size);
+    
+    if (repair) {
+        if (corrupt) {
+            printf("AVISO: %s com cabeçalho inválido, movido para %s%s\n",
+                   SCORE_LOG_FILE, SCORE_LOG_FILE, copySuffix);
+        }
+        printf("AVISO: %s tinha %d registro(s) inválido(s)%s, recuperando %d partidas\n", 
+               SCORE_LOG_FILE, skipped, truncated ? " e um registro incompleto" : "", runCount);
+        if (copied) {
+            rewriteScoreFile();
+        } else {
+            printf("AVISO: não foi possível criar %s%s, arquivo mantido como está\n",
+                   SCORE_LOG_FILE, copySuffix);
+        }
+    }
 }
 
 
 bool IsHighScore(long score) {
-    if (scoreCount < MAX_SCORES) {
+    int count = topCount[SORT_BY_SCORE];
+    if (count < MAX_SCORES) {
         return true; 
     }
     
+    return score > runs[topRuns[SORT_BY_SCORE][count - 1]].score;
+}
+
+
+bool IsHighKills(int kills) {
+    int count = topCount[SORT_BY_KILLS];
+    if (count < MAX_SCORES) {
+        return true;
+    }
     
-    return score > scores[scoreCount-1].score;
+    return kills > runs[topRuns[SORT_BY_KILLS][count - 1]].kills;
 }
 
 
-int GetScorePosition(long score) {
-    for (int i = 0; i < scoreCount; i++) {
-        if (score > scores[i].score) {
-            return i;
-        }
+bool IsFastTime(float gameTime) {
+    int count = topCount[SORT_BY_TIME];
+    if (count < MAX_SCORES) {
+        return true;
     }
-    return scoreCount;
+    
+    return gameTime < runs[topRuns[SORT_BY_TIME][count - 1]].gameTime;
 }
 
 
 void DrawScoreboard(SortType sortType) {
     
-    SortScoreboard(sortType);
+    SetScoreboardView(sortType);
     
     const int titleFontSize = 50;
     const int headerFontSize = 30;
@@ -211,10 +717,14 @@ void DrawScoreboard(SortType sortType) {
     
     DrawText("POS", GetScreenWidth()/2 - 250, startY, headerFontSize, textColor);
     DrawText("NOME", GetScreenWidth()/2 - 150, startY, headerFontSize, textColor);
-    DrawText("PONTUAÇÃO", GetScreenWidth()/2 + 100, startY, headerFontSize, textColor);
+    const char *valueHeader = (sortType == SORT_BY_KILLS) ? "KILLS" :
+                              (sortType == SORT_BY_TIME) ? "TEMPO" : "PONTUAÇÃO";
+    DrawText(valueHeader, GetScreenWidth()/2 + 100, startY, headerFontSize, textColor);
     
     
+    int scoreCount = GetScoreCount();
     for (int i = 0; i < scoreCount; i++) {
+        ScoreEntry entry = GetScoreAt(i);
         int y = startY + (i+1) * lineHeight;
         
         
@@ -223,13 +733,19 @@ void DrawScoreboard(SortType sortType) {
         DrawText(posText, GetScreenWidth()/2 - 250, y, scoreFontSize, textColor);
         
         
-        Color nameColor = scores[i].isNew ? GOLD : textColor;
-        DrawText(scores[i].name, GetScreenWidth()/2 - 150, y, scoreFontSize, nameColor);
+        Color nameColor = entry.isNew ? GOLD : textColor;
+        DrawText(entry.name, GetScreenWidth()/2 - 150, y, scoreFontSize, nameColor);
         
         
-        char scoreText[20];
-        sprintf(scoreText, "%ld", scores[i].score);
-        DrawText(scoreText, GetScreenWidth()/2 + 100, y, scoreFontSize, textColor);
+        char valueText[20];
+        if (sortType == SORT_BY_KILLS) {
+            sprintf(valueText, "%d", entry.kills);
+        } else if (sortType == SORT_BY_TIME) {
+            sprintf(valueText, "%s", FormatTime(entry.gameTime));
+        } else {
+            sprintf(valueText, "%ld", entry.score);
+        }
+        DrawText(valueText, GetScreenWidth()/2 + 100, y, scoreFontSize, textColor);
     }
     
     
@@ -240,24 +756,40 @@ void DrawScoreboard(SortType sortType) {
 
 
 void ResetNewFlags(void) {
-    for (int i = 0; i < scoreCount; i++) {
-        scores[i].isNew = false;
+    if (newRunIndex >= 0) {
+        runs[newRunIndex].isNew = false;
+        newRunIndex = -1;
     }
 }
 
 
+SortType GetScoreboardView(void) {
+    return activeSortType;
+}
+
+
+unsigned int GetScoreboardVersion(void) {
+    return scoreboardVersion;
+}
+
+
 int GetScoreCount(void) {
-    return scoreCount;
+    return topCount[activeSortType];
+}
+
+
+int GetRunCount(void) {
+    return runCount;
 }
 
 
 ScoreEntry GetScoreAt(int index) {
-    if (index >= 0 && index < scoreCount) {
-        return scores[index];
+    if (index >= 0 && index < topCount[activeSortType]) {
+        return runs[topRuns[activeSortType][index]];
     }
     
     
-    ScoreEntry empty = {"", 0, false};
+    ScoreEntry empty = {"", 0, 0, 0.0f, false};
     return empty;
 }
 
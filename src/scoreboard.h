@@ -6,13 +6,25 @@
 #define MAX_SCORES 10        
 #define MAX_NAME_LENGTH 50   
 
+#define SCORE_LOG_FILE "runs.log"       // Histórico de todas as partidas (só acréscimo)
+#define LEGACY_SCORE_FILE "scores.dat"  // Formato antigo, importado uma vez
+
 
 typedef enum {
     SORT_BY_SCORE,   
     SORT_BY_KILLS,   
-    SORT_BY_TIME     
+    SORT_BY_TIME,    
+    SORT_TYPE_COUNT
 } SortType;
 
+// Estado da gravação em segundo plano, consultado pela interface
+typedef enum {
+    SCORE_SAVE_IDLE,      // nada enviado nesta sessão
+    SCORE_SAVE_PENDING,   // registros na fila ou sendo gravados
+    SCORE_SAVE_DONE,      // tudo gravado e sincronizado no disco
+    SCORE_SAVE_FAILED     // alguma gravação falhou
+} ScoreSaveStatus;
+
 typedef struct {
     char name[MAX_NAME_LENGTH];  
     long score;                  
@@ -23,10 +35,13 @@ typedef struct {
 
 
 void InitScoreboard(void);
+void ShutdownScoreboard(void);
 void AddScore(const char *name, long score, int kills, float gameTime);
 void SaveScoreboard(void);
 void LoadScoreboard(void);
-void SortScoreboard(SortType sortType);
+void SetScoreboardView(SortType sortType);
+SortType GetScoreboardView(void);
+unsigned int GetScoreboardVersion(void);
 void DrawScoreboard(SortType sortType);
 void DrawGameSummary(long score, int kills, float gameTime);
 bool IsHighScore(long score);
@@ -36,6 +51,8 @@ void ResetNewFlags(void);
 
 
 int GetScoreCount(void);
+int GetRunCount(void);
+ScoreSaveStatus GetScoreSaveStatus(void);
 ScoreEntry GetScoreAt(int index);
 const char* FormatTime(float seconds); 
 
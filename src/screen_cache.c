@@ -0,0 +1,116 @@
+#include "screen_cache.h"
+#include "raylib.h"
+#include "rlgl.h"
+#include <stdio.h>
+
+
+typedef struct {
+    RenderTexture2D target;
+    bool loaded;
+    bool valid;
+    unsigned int contentKey;
+    int width;
+    int height;
+} ScreenLayer;
+
+
+static ScreenLayer layers[SCREEN_CACHE_COUNT] = { 0 };
+static int capturingLayer = -1;
+
+
+bool BeginScreenCache(ScreenCacheId id, unsigned int contentKey) {
+    ScreenLayer *layer = &layers[id];
+    int width = GetScreenWidth();
+    int height = GetScreenHeight();
+    
+    if (layer->valid && layer->contentKey == contentKey &&
+        layer->width == width && layer->height == height) {
+        return false;
+    }
+    
+    if (layer->loaded && (layer->width != width || layer->height != height)) {
+        UnloadRenderTexture(layer->target);
+        layer->loaded = false;
+    }
+    
+    if (!layer->loaded) {
+        layer->target = LoadRenderTexture(width, height);
+        if (!IsRenderTextureReady(layer->target)) {
+            // Sem render texture: desenhar direto na tela todo frame
+            layer->valid = false;
+            return true;
+        }
+        layer->loaded = true;
+        layer->width = width;
+        layer->height = height;
+    }
+    
+    BeginTextureMode(layer->target);
+    ClearBackground(BLANK);
+    
+    // Guardar a camada com alfa pré-multiplicado para compor sem escurecer
+    // as bordas translúcidas (texto, retângulos com Fade)
+    rlSetBlendFactorsSeparate(RL_SRC_ALPHA, RL_ONE_MINUS_SRC_ALPHA, RL_ONE, RL_ONE_MINUS_SRC_ALPHA,
+                              RL_FUNC_ADD, RL_FUNC_ADD);
+    BeginBlendMode(BLEND_CUSTOM_SEPARATE);
+    
+    layer->contentKey = contentKey;
+    capturingLayer = id;
+    return true;
+}
+
+
+void EndScreenCache(void) {
+    if (capturingLayer < 0) {
+        return;
+    }
+    
+    EndBlendMode();
+    EndTextureMode();
+    
+    layers[capturingLayer].valid = true;
+    capturingLayer = -1;
+}
+
+
+void DrawScreenCache(ScreenCacheId id, float alpha) {
+    const ScreenLayer *layer = &layers[id];
+    if (!layer->valid) {
+        return;
+    }
+    
+    if (alpha < 0.0f) alpha = 0.0f;
+    if (alpha > 1.0f) alpha = 1.0f;
+    
+    // Cor pré-multiplicada: a opacidade escala todos os canais
+    unsigned char a = (unsigned char)(alpha * 255.0f);
+    Color tint = { a, a, a, a };
+    
+    // Render textures ficam invertidos em Y
+    Rectangle source = { 0.0f, 0.0f, (float)layer->width, -(float)layer->height };
+    
+    BeginBlendMode(BLEND_ALPHA_PREMULTIPLY);
+    DrawTextureRec(layer->target.texture, source, (Vector2){ 0.0f, 0.0f }, tint);
+    EndBlendMode();
+}
+
+
+bool IsScreenCacheCapturing(void) {
+    return capturingLayer >= 0;
+}
+
+
+void InvalidateScreenCache(ScreenCacheId id) {
+    layers[id].valid = false;
+}
+
+
+void UnloadScreenCaches(void) {
+    for (int i = 0; i < SCREEN_CACHE_COUNT; i++) {
+        if (layers[i].loaded) {
+            UnloadRenderTexture(layers[i].target);
+        }
+        layers[i].loaded = false;
+        layers[i].valid = false;
+    }
+}
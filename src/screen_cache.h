@@ -0,0 +1,36 @@
+#ifndef SCREEN_CACHE_H
+#define SCREEN_CACHE_H
+
+#include <stdbool.h>
+
+// Camadas estáticas das telas de menu, guardadas em render textures
+typedef enum {
+    SCREEN_CACHE_MAIN_MENU,
+    SCREEN_CACHE_TUTORIAL,
+    SCREEN_CACHE_PAUSE,
+    SCREEN_CACHE_SCOREBOARD,
+    SCREEN_CACHE_NAME_ENTRY,
+    SCREEN_CACHE_COUNT
+} ScreenCacheId;
+
+// Uso:
+//     if (BeginScreenCache(id, chave)) { ...desenha a parte estática...; EndScreenCache(); }
+//     DrawScreenCache(id, 1.0f);
+//     ...desenha só as partes animadas...
+// BeginScreenCache retorna true quando a camada precisa ser redesenhada: primeira
+// vez, chave de conteúdo diferente, janela redimensionada ou invalidação explícita.
+// Se o render texture não puder ser criado, retorna true sempre e o conteúdo é
+// desenhado direto na tela (DrawScreenCache não faz nada).
+bool BeginScreenCache(ScreenCacheId id, unsigned int contentKey);
+void EndScreenCache(void);
+
+// Compõe a camada na tela; alpha multiplica a opacidade da camada inteira
+void DrawScreenCache(ScreenCacheId id, float alpha);
+
+// Verdadeiro enquanto uma camada está sendo capturada (cursor e pós-processos ficam de fora)
+bool IsScreenCacheCapturing(void);
+
+void InvalidateScreenCache(ScreenCacheId id);
+void UnloadScreenCaches(void);
+
+#endif
@@ -0,0 +1,198 @@
+#include "spatial_grid.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+
+static int clampCell(int value, int count) {
+    if (value < 0) return 0;
+    if (value >= count) return count - 1;
+    return value;
+}
+
+static int cellIndex(const SpatialGrid *grid, Vector2 position) {
+    int column = clampCell((int)floorf(position.x / grid->cellSize), grid->columns);
+    int row = clampCell((int)floorf(position.y / grid->cellSize), grid->rows);
+    return row * grid->columns + column;
+}
+
+static bool growEntries(SpatialGrid *grid) {
+    int capacity = (grid->capacity == 0) ? 128 : grid->capacity * 2;
+    
+    GridEntry *entries = realloc(grid->entries, capacity * sizeof(GridEntry));
+    if (entries == NULL) return false;
+    grid->entries = entries;
+    
+    GridEntry *sorted = realloc(grid->sorted, capacity * sizeof(GridEntry));
+    if (sorted == NULL) return false;
+    grid->sorted = sorted;
+    
+    int *cellOf = realloc(grid->cellOf, capacity * sizeof(int));
+    if (cellOf == NULL) return false;
+    grid->cellOf = cellOf;
+    
+    grid->capacity = capacity;
+    return true;
+}
+
+
+void BeginSpatialGrid(SpatialGrid *grid, float width, float height, float cellSize) {
+    grid->cellSize = cellSize;
+    grid->columns = (int)ceilf(width / cellSize);
+    grid->rows = (int)ceilf(height / cellSize);
+    if (grid->columns < 1) grid->columns = 1;
+    if (grid->rows < 1) grid->rows = 1;
+    
+    int cells = grid->columns * grid->rows;
+    if (cells + 1 > grid->cellCapacity) {
+        int *cellStart = realloc(grid->cellStart, (cells + 1) * sizeof(int));
+        if (cellStart == NULL) {
+            // Sem memória: uma única célula ainda dá resultados corretos
+            grid->columns = 1;
+            grid->rows = 1;
+            cells = 1;
+        } else {
+            grid->cellStart = cellStart;
+            grid->cellCapacity = cells + 1;
+        }
+    }
+    
+    grid->count = 0;
+    grid->maxRadius = 0.0f;
+}
+
+
+void AddToSpatialGrid(SpatialGrid *grid, void *item, Vector2 position, float radius) {
+    if (grid->count == grid->capacity && !growEntries(grid)) {
+        return;
+    }
+    
+    grid->entries[grid->count] = (GridEntry){ item, position, radius };
+    grid->count++;
+    if (radius > grid->maxRadius) grid->maxRadius = radius;
+}
+
+
+void EndSpatialGrid(SpatialGrid *grid) {
+    if (grid->cellStart == NULL) {
+        return;
+    }
+    
+    int cells = grid->columns * grid->rows;
+    memset(grid->cellStart, 0, (cells + 1) * sizeof(int));
+    
+    // Contagem por célula, prefixo e depois a distribuição estável
+    for (int i = 0; i < grid->count; i++) {
+        grid->cellOf[i] = cellIndex(grid, grid->entries[i].position);
+        grid->cellStart[grid->cellOf[i] + 1]++;
+    }
+    for (int cell = 0; cell < cells; cell++) {
+        grid->cellStart[cell + 1] += grid->cellStart[cell];
+    }
+    for (int i = 0; i < grid->count; i++) {
+        // cellStart[c] anda durante a distribuição e termina no início de c + 1
+        grid->sorted[grid->cellStart[grid->cellOf[i]]++] = grid->entries[i];
+    }
+    for (int cell = cells; cell > 0; cell--) {
+        grid->cellStart[cell] = grid->cellStart[cell - 1];
+    }
+    grid->cellStart[0] = 0;
+}
+
+
+int QuerySpatialGrid(const SpatialGrid *grid, Vector2 center, float range, const GridEntry **results, int maxResults) {
+    if (grid->count == 0 || grid->cellStart == NULL) {
+        return 0;
+    }
+    
+    // Uma entrada pode estar na célula vizinha e ainda tocar o círculo pelo raio
+    float reach = range + grid->maxRadius;
+    int firstColumn = clampCell((int)floorf((center.x - reach) / grid->cellSize), grid->columns);
+    int lastColumn = clampCell((int)floorf((center.x + reach) / grid->cellSize), grid->columns);
+    int firstRow = clampCell((int)floorf((center.y - reach) / grid->cellSize), grid->rows);
+    int lastRow = clampCell((int)floorf((center.y + reach) / grid->cellSize), grid->rows);
+    
+    int found = 0;
+    for (int row = firstRow; row <= lastRow; row++) {
+        for (int column = firstColumn; column <= lastColumn; column++) {
+            int cell = row * grid->columns + column;
+            for (int i = grid->cellStart[cell]; i < grid->cellStart[cell + 1]; i++) {
+                const GridEntry *entry = &grid->sorted[i];
+                float dx = entry->position.x - center.x;
+                float dy = entry->position.y - center.y;
+                float limit = range + entry->radius;
+                if (dx * dx + dy * dy > limit * limit) continue;
+                
+                results[found++] = entry;
+                if (found == maxResults) return found;
+            }
+        }
+    }
+    return found;
+}
+
+
+static void nearestInCell(const SpatialGrid *grid, int column, int row, Vector2 center,
+                          const GridEntry **best, float *bestSqr) {
+    if (column < 0 || column >= grid->columns || row < 0 || row >= grid->rows) return;
+    
+    int cell = row * grid->columns + column;
+    for (int i = grid->cellStart[cell]; i < grid->cellStart[cell + 1]; i++) {
+        const GridEntry *entry = &grid->sorted[i];
+        float dx = entry->position.x - center.x;
+        float dy = entry->position.y - center.y;
+        float distanceSqr = dx * dx + dy * dy;
+        if (distanceSqr < *bestSqr) {
+            *best = entry;
+            *bestSqr = distanceSqr;
+        }
+    }
+}
+
+const GridEntry *FindNearestInSpatialGrid(const SpatialGrid *grid, Vector2 center, float maxRange) {
+    if (grid->count == 0 || grid->cellStart == NULL) {
+        return NULL;
+    }
+    
+    // Célula sem limitar à grade: fora da tela os anéis só pulam células inexistentes
+    int centerColumn = (int)floorf(center.x / grid->cellSize);
+    int centerRow = (int)floorf(center.y / grid->cellSize);
+    int lastRing = (int)ceilf(maxRange / grid->cellSize);
+    // Além disso os anéis já não cruzam a grade
+    int gridSpan = (grid->columns > grid->rows) ? grid->columns : grid->rows;
+    int outside = 0;
+    if (-centerColumn > outside) outside = -centerColumn;
+    if (centerColumn - grid->columns + 1 > outside) outside = centerColumn - grid->columns + 1;
+    if (-centerRow > outside) outside = -centerRow;
+    if (centerRow - grid->rows + 1 > outside) outside = centerRow - grid->rows + 1;
+    if (lastRing > gridSpan + outside) lastRing = gridSpan + outside;
+    
+    const GridEntry *best = NULL;
+    float bestSqr = maxRange * maxRange;
+    for (int ring = 0; ring <= lastRing; ring++) {
+        // Qualquer ponto do anel ring está a pelo menos (ring - 1) células de center
+        float nearest = (ring - 1) * grid->cellSize;
+        if (ring > 1 && nearest * nearest >= bestSqr) break;
+        
+        for (int row = centerRow - ring; row <= centerRow + ring; row++) {
+            if (row == centerRow - ring || row == centerRow + ring) {
+                for (int column = centerColumn - ring; column <= centerColumn + ring; column++) {
+                    nearestInCell(grid, column, row, center, &best, &bestSqr);
+                }
+            } else {
+                nearestInCell(grid, centerColumn - ring, row, center, &best, &bestSqr);
+                nearestInCell(grid, centerColumn + ring, row, center, &best, &bestSqr);
+            }
+        }
+    }
+    return best;
+}
+
+
+void FreeSpatialGrid(SpatialGrid *grid) {
+    free(grid->cellStart);
+    free(grid->entries);
+    free(grid->sorted);
+    free(grid->cellOf);
+    memset(grid, 0, sizeof(SpatialGrid));
+}
@@ -0,0 +1,47 @@
+#ifndef SPATIAL_GRID_H
+#define SPATIAL_GRID_H
+
+#include "raylib.h"
+
+// Broadphase em grade uniforme sobre a tela. Reconstruída a cada tick:
+// os itens são adicionados soltos e depois ordenados por célula (contagem),
+// para que cada célula seja um trecho contíguo do vetor de entradas.
+typedef struct {
+    void *item;
+    Vector2 position;
+    float radius;
+} GridEntry;
+
+typedef struct {
+    float cellSize;
+    int columns;
+    int rows;
+    int *cellStart;          // columns * rows + 1 posições em sorted
+    int cellCapacity;
+
+    GridEntry *entries;      // na ordem de inserção
+    GridEntry *sorted;       // agrupadas por célula
+    int *cellOf;
+    float maxRadius;         // maior raio inserido, para alargar a busca
+    int count;
+    int capacity;
+} SpatialGrid;
+
+// Esvazia a grade e ajusta o tamanho à área dada (normalmente a tela)
+void BeginSpatialGrid(SpatialGrid *grid, float width, float height, float cellSize);
+void AddToSpatialGrid(SpatialGrid *grid, void *item, Vector2 position, float radius);
+// Agrupa as entradas por célula; as consultas só valem depois desta chamada
+void EndSpatialGrid(SpatialGrid *grid);
+
+// Entradas cujo círculo toca o círculo (center, range). Devolve quantas foram
+// escritas em results, no máximo maxResults.
+int QuerySpatialGrid(const SpatialGrid *grid, Vector2 center, float range, const GridEntry **results, int maxResults);
+
+// Entrada com o centro mais perto de center, até maxRange (NULL se nenhuma).
+// Varre anéis de células a partir da célula de center e para assim que o
+// próximo anel não pode ter nada mais perto que o melhor já achado.
+const GridEntry *FindNearestInSpatialGrid(const SpatialGrid *grid, Vector2 center, float maxRange);
+
+void FreeSpatialGrid(SpatialGrid *grid);
+
+#endif
@@ -0,0 +1,282 @@
+#include "spawn_table.h"
+#include "asset_pack.h"
+#include "raylib.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+
+// Uma faixa de pontuação com o amostrador de alias dos tipos (método de Vose):
+// sorteia uma coluna uniforme e depois uma moeda contra o limiar da coluna;
+// se a moeda falhar, o tipo é o alias. Custo constante para qualquer número de tipos.
+typedef struct {
+    long minScore;
+    float weights[ENEMY_TYPE_COUNT];
+    uint32_t threshold[ENEMY_TYPE_COUNT];   // em 1/65536
+    uint8_t alias[ENEMY_TYPE_COUNT];
+} SpawnBand;
+
+// Curva de atributos por tipo: faixa sorteada mais ganho de velocidade com a pontuação
+typedef struct {
+    float radiusMin;
+    float radiusMax;
+    float speedMin;
+    float speedMax;
+    float speedPerThousand;   // velocidade extra a cada 1000 pontos
+} SpawnStats;
+
+
+static SpawnBand bands[MAX_SPAWN_BANDS];
+static int bandCount = 0;
+static SpawnStats typeStats[ENEMY_TYPE_COUNT];
+static float speedCap = ENEMY_SPEED_MAX * 2;
+static SpawnBurst burst = { 0 };
+
+static uint32_t randomState = 0;
+
+static const char *typeNames[ENEMY_TYPE_COUNT] = { "normal", "speeder", "tank", "exploder", "shooter" };
+
+
+// xorshift32: um sorteio de 32 bits por chamada, semeado uma vez pelo raylib
+static uint32_t nextRandom(void) {
+    if (randomState == 0) {
+        randomState = ((uint32_t)GetRandomValue(0, 0x7FFF) << 16) ^ (uint32_t)GetRandomValue(1, 0x7FFF);
+    }
+    
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+    return randomState;
+}
+
+static float randomRange(float min, float max) {
+    return min + (max - min) * SpawnRandomUnit();
+}
+
+static int findTypeByName(const char *name) {
+    for (int i = 0; i < ENEMY_TYPE_COUNT; i++) {
+        if (strcmp(typeNames[i], name) == 0) return i;
+    }
+    return -1;
+}
+
+// Monta as colunas do alias a partir dos pesos da faixa
+static bool buildAliasTable(SpawnBand *band) {
+    float total = 0.0f;
+    for (int i = 0; i < ENEMY_TYPE_COUNT; i++) {
+        if (band->weights[i] < 0.0f) return false;
+        total += band->weights[i];
+    }
+    if (total <= 0.0f) return false;
+    
+    float scaled[ENEMY_TYPE_COUNT];
+    int small[ENEMY_TYPE_COUNT];
+    int large[ENEMY_TYPE_COUNT];
+    int smallCount = 0;
+    int largeCount = 0;
+    
+    for (int i = 0; i < ENEMY_TYPE_COUNT; i++) {
+        scaled[i] = band->weights[i] * ENEMY_TYPE_COUNT / total;
+        if (scaled[i] < 1.0f) small[smallCount++] = i;
+        else large[largeCount++] = i;
+    }
+    
+    while (smallCount > 0 && largeCount > 0) {
+        int lighter = small[--smallCount];
+        int heavier = large[--largeCount];
+        
+        band->threshold[lighter] = (uint32_t)(scaled[lighter] * 65536.0f + 0.5f);
+        band->alias[lighter] = (uint8_t)heavier;
+        
+        // O que sobrou da coluna pesada volta para a lista certa
+        scaled[heavier] = (scaled[heavier] + scaled[lighter]) - 1.0f;
+        if (scaled[heavier] < 1.0f) small[smallCount++] = heavier;
+        else large[largeCount++] = heavier;
+    }
+    
+    // Sobras (inclusive por arredondamento) ficam com a própria coluna
+    while (largeCount > 0) {
+        int column = large[--largeCount];
+        band->threshold[column] = 65536;
+        band->alias[column] = (uint8_t)column;
+    }
+    while (smallCount > 0) {
+        int column = small[--smallCount];
+        band->threshold[column] = 65536;
+        band->alias[column] = (uint8_t)column;
+    }
+    
+    return true;
+}
+
+// Mesma distribuição e curvas que o jogo usava antes da tabela em arquivo
+static void loadBuiltinTable(void) {
+    static const SpawnBand builtinBands[] = {
+        { .minScore = 0,    .weights = { 100.0f, 0.0f,  0.0f,  0.0f,  0.0f  } },
+        { .minScore = 1000, .weights = { 50.0f,  0.0f,  25.0f, 15.0f, 10.0f } },
+        { .minScore = 2000, .weights = { 35.0f,  10.0f, 30.0f, 15.0f, 10.0f } },
+        { .minScore = 3000, .weights = { 20.0f,  15.0f, 30.0f, 30.0f, 5.0f  } }
+    };
+    
+    bandCount = (int)(sizeof(builtinBands) / sizeof(builtinBands[0]));
+    for (int i = 0; i < bandCount; i++) {
+        bands[i] = builtinBands[i];
+        buildAliasTable(&bands[i]);
+    }
+    
+    typeStats[ENEMY_TYPE_NORMAL] = (SpawnStats){ ENEMY_RADIUS_MIN, ENEMY_RADIUS_MAX, ENEMY_SPEED_MIN, ENEMY_SPEED_MAX, 1.0f };
+    typeStats[ENEMY_TYPE_SPEEDER] = (SpawnStats){ ENEMY_RADIUS_MIN, ENEMY_RADIUS_MIN, ENEMY_SPEED_MAX, ENEMY_SPEED_MAX, 1.0f };
+    typeStats[ENEMY_TYPE_TANK] = (SpawnStats){ ENEMY_RADIUS_MAX, ENEMY_RADIUS_MAX, ENEMY_SPEED_MIN, ENEMY_SPEED_MIN, 1000.0f / 2000.0f };
+    typeStats[ENEMY_TYPE_EXPLODER] = (SpawnStats){ ENEMY_RADIUS_MIN + 5.0f, ENEMY_RADIUS_MIN + 5.0f,
+                                                   ENEMY_SPEED_MIN + ENEMY_SPEED_MAX / 2.0f,
+                                                   ENEMY_SPEED_MIN + ENEMY_SPEED_MAX / 2.0f, 1000.0f / 1500.0f };
+    typeStats[ENEMY_TYPE_SHOOTER] = (SpawnStats){ ENEMY_RADIUS_MIN + 3.0f, ENEMY_RADIUS_MIN + 3.0f,
+                                                  ENEMY_SPEED_MIN + ENEMY_SPEED_MAX / 3.0f,
+                                                  ENEMY_SPEED_MIN + ENEMY_SPEED_MAX / 3.0f, 1000.0f / 1800.0f };
+    speedCap = ENEMY_SPEED_MAX * 2;
+    burst = (SpawnBurst){ 0 };
+}
+
+static bool rejectLine(const AssetTextReader *reader) {
+    return RejectAssetLine(reader, "a tabela embutida");
+}
+
+// Formato (uma diretiva por linha, '#' comenta):
+//   band <pontuação mínima> <tipo>:<peso> ...      tipos ausentes têm peso 0
+//   stats <tipo> <raio mín> <raio máx> <vel. mín> <vel. máx> <vel. a cada 1000 pontos>
+//   speed_cap <velocidade máxima>
+//   burst <a cada N segundos> <inimigos> <espaçamento em segundos>
+// Tipos sem linha stats mantêm a curva embutida.
+static bool parseSpawnTable(AssetTextReader *reader) {
+    int parsedBands = 0;
+    SpawnBand parsed[MAX_SPAWN_BANDS];
+    
+    char *line;
+    while ((line = NextAssetLine(reader)) != NULL) {
+        char *directive = strtok(line, " \t\r");
+        
+        if (strcmp(directive, "band") == 0) {
+            char *scoreToken = strtok(NULL, " \t\r");
+            if (scoreToken == NULL || parsedBands == MAX_SPAWN_BANDS) return rejectLine(reader);
+            
+            SpawnBand *band = &parsed[parsedBands];
+            memset(band, 0, sizeof(SpawnBand));
+            band->minScore = strtol(scoreToken, NULL, 10);
+            if (parsedBands > 0 && band->minScore <= parsed[parsedBands - 1].minScore) return rejectLine(reader);
+            
+            char *entry;
+            while ((entry = strtok(NULL, " \t\r")) != NULL) {
+                char *separator = strchr(entry, ':');
+                if (separator == NULL) return rejectLine(reader);
+                *separator = '\0';
+                int type = findTypeByName(entry);
+                if (type < 0) return rejectLine(reader);
+                band->weights[type] = strtof(separator + 1, NULL);
+            }
+            
+            if (!buildAliasTable(band)) return rejectLine(reader);
+            parsedBands++;
+        } else if (strcmp(directive, "stats") == 0) {
+            char *name = strtok(NULL, " \t\r");
+            int type = name ? findTypeByName(name) : -1;
+            if (type < 0) return rejectLine(reader);
+            
+            float values[5];
+            for (int i = 0; i < 5; i++) {
+                char *token = strtok(NULL, " \t\r");
+                if (token == NULL) return rejectLine(reader);
+                values[i] = strtof(token, NULL);
+            }
+            if (values[0] > values[1] || values[2] > values[3]) return rejectLine(reader);
+            typeStats[type] = (SpawnStats){ values[0], values[1], values[2], values[3], values[4] };
+        } else if (strcmp(directive, "speed_cap") == 0) {
+            char *token = strtok(NULL, " \t\r");
+            if (token == NULL) return rejectLine(reader);
+            speedCap = strtof(token, NULL);
+        } else if (strcmp(directive, "burst") == 0) {
+            float values[3];
+            for (int i = 0; i < 3; i++) {
+                char *token = strtok(NULL, " \t\r");
+                if (token == NULL) return rejectLine(reader);
+                values[i] = strtof(token, NULL);
+            }
+            if (values[0] < 0.0f || values[1] < 1.0f || values[2] < 0.0f) return rejectLine(reader);
+            burst = (SpawnBurst){ values[0], (int)values[1], values[2] };
+        } else {
+            return rejectLine(reader);
+        }
+    }
+    
+    if (parsedBands == 0) {
+        printf("AVISO: %s sem faixas de spawn, usando a tabela embutida\n", SPAWN_TABLE_FILE);
+        return false;
+    }
+    
+    memcpy(bands, parsed, parsedBands * sizeof(SpawnBand));
+    bandCount = parsedBands;
+    return true;
+}
+
+
+void LoadSpawnTable(void) {
+    loadBuiltinTable();
+    
+    AssetTextReader reader;
+    bool loaded = false;
+    if (OpenAssetText(&reader, SPAWN_TABLE_FILE)) {
+        loaded = parseSpawnTable(&reader);
+        CloseAssetText(&reader);
+    }
+    
+    // Uma tabela com erro não pode deixar curvas pela metade
+    if (!loaded) {
+        loadBuiltinTable();
+    }
+}
+
+
+SpawnBurst GetSpawnBurst(void) {
+    return burst;
+}
+
+
+float SpawnRandomUnit(void) {
+    return (nextRandom() >> 8) * (1.0f / 16777216.0f);
+}
+
+
+SpawnSpec RollSpawn(long score) {
+    if (bandCount == 0) {
+        loadBuiltinTable();
+    }
+    
+    // Última faixa cuja pontuação mínima já foi atingida
+    int low = 0;
+    int high = bandCount - 1;
+    while (low < high) {
+        int mid = (low + high + 1) / 2;
+        if (bands[mid].minScore <= score) low = mid;
+        else high = mid - 1;
+    }
+    const SpawnBand *band = &bands[low];
+    
+    // Um único sorteio: 16 bits escolhem a coluna, 16 bits são a moeda
+    uint32_t bits = nextRandom();
+    int column = (int)(((bits >> 16) * ENEMY_TYPE_COUNT) >> 16);
+    uint32_t coin = bits & 0xFFFF;
+    
+    SpawnSpec spec;
+    spec.type = (coin < band->threshold[column]) ? (EnemyType)column : (EnemyType)band->alias[column];
+    
+    const SpawnStats *stats = &typeStats[spec.type];
+    spec.radius = (stats->radiusMin == stats->radiusMax) ? stats->radiusMin :
+                  randomRange(stats->radiusMin, stats->radiusMax);
+    spec.speed = (stats->speedMin == stats->speedMax) ? stats->speedMin :
+                 randomRange(stats->speedMin, stats->speedMax);
+    spec.speed += stats->speedPerThousand * (score / 1000.0f);
+    
+    if (spec.speed > speedCap) spec.speed = speedCap;
+    
+    return spec;
+}
@@ -0,0 +1,38 @@
+#ifndef SPAWN_TABLE_H
+#define SPAWN_TABLE_H
+
+#include "enemy.h"
+
+#define SPAWN_TABLE_FILE "assets/spawn_table.txt"
+#define MAX_SPAWN_BANDS 16
+
+// Resultado de um sorteio: tipo e atributos já calculados para a pontuação
+typedef struct {
+    EnemyType type;
+    float radius;
+    float speed;
+} SpawnSpec;
+
+// Onda em rajada: count inimigos do mesmo lado, separados por spacing segundos,
+// a cada period segundos de spawn. period 0 desliga as rajadas.
+typedef struct {
+    float period;
+    int count;
+    float spacing;
+} SpawnBurst;
+
+// Lê a tabela do pacote de assets ou do arquivo solto; se não existir ou tiver
+// erro, usa a tabela embutida (a mesma distribuição de antes da tabela existir).
+// Chamar depois do pacote de assets ser aberto.
+void LoadSpawnTable(void);
+
+// Sorteia tipo (amostrador de alias da faixa de pontuação, O(1)) e atributos
+SpawnSpec RollSpawn(long score);
+
+// Configuração das rajadas lida da tabela (desligadas na tabela embutida)
+SpawnBurst GetSpawnBurst(void);
+
+// Número aleatório em [0, 1) do mesmo gerador, para ângulo e lado do spawn
+float SpawnRandomUnit(void);
+
+#endif
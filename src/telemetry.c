@@ -0,0 +1,219 @@
+#if !defined(_WIN32)
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "telemetry.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <pthread.h>
+
+
+#define FLUSH_INTERVAL_MS 1000   // a thread grava pelo menos uma vez por segundo
+
+
+// Anel de registros já codificados. O jogo só copia 16 bytes sob o mutex;
+// a thread tira blocos inteiros e grava fora dele.
+static unsigned char ring[TELEMETRY_RING_CAPACITY][TELEMETRY_RECORD_SIZE];
+static int ringHead = 0;       // próximo a escrever
+static int ringCount = 0;
+static unsigned int droppedRecords = 0;
+static float lastRecordTime = 0.0f;   // tempo do último registro, para o aviso de descarte
+
+static pthread_t flushThread;
+static pthread_mutex_t ringMutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t flushCond = PTHREAD_COND_INITIALIZER;
+static bool flushThreadRunning = false;
+static bool flushStopRequested = false;
+
+static bool telemetryEnabled = false;
+static FILE *telemetryFile = NULL;
+static float currentGameTime = 0.0f;
+
+
+static void putU16(unsigned char *out, uint16_t value) {
+    out[0] = value & 0xFF;
+    out[1] = (value >> 8) & 0xFF;
+}
+
+static void putU32(unsigned char *out, uint32_t value) {
+    for (int i = 0; i < 4; i++) out[i] = (value >> (8 * i)) & 0xFF;
+}
+
+static void putF32(unsigned char *out, float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    putU32(out, bits);
+}
+
+static void encodeRecord(unsigned char *out, int type, int detail, float gameTime, float value, uint32_t extra) {
+    out[0] = (unsigned char)type;
+    out[1] = (unsigned char)detail;
+    putU16(out + 2, 0);
+    putF32(out + 4, gameTime);
+    putF32(out + 8, value);
+    putU32(out + 12, extra);
+}
+
+// Abre o arquivo para acréscimo, escrevendo o cabeçalho se ele for novo
+static FILE *openTelemetryFile(const char *path) {
+    FILE *file = fopen(path, "ab");
+    if (file == NULL) return NULL;
+    
+    if (ftell(file) == 0) {
+        unsigned char header[TELEMETRY_HEADER_SIZE] = { 0 };
+        memcpy(header, TELEMETRY_FILE_MAGIC, 4);
+        putU16(header + 4, TELEMETRY_FILE_VERSION);
+        putU16(header + 6, TELEMETRY_RECORD_SIZE);
+        if (fwrite(header, 1, sizeof(header), file) != sizeof(header)) {
+            fclose(file);
+            return NULL;
+        }
+    }
+    
+    return file;
+}
+
+// Tira do anel os registros mais antigos (até o fim físico do anel) e grava.
+// Chamado com o mutex travado; solta o mutex durante a escrita.
+static void drainRing(void) {
+    while (ringCount > 0) {
+        int tail = (ringHead - ringCount + TELEMETRY_RING_CAPACITY) % TELEMETRY_RING_CAPACITY;
+        int chunk = ringCount;
+        if (tail + chunk > TELEMETRY_RING_CAPACITY) {
+            chunk = TELEMETRY_RING_CAPACITY - tail;
+        }
+        
+        // Copiar o bloco para fora do anel antes de soltar o mutex
+        static unsigned char batch[TELEMETRY_RING_CAPACITY][TELEMETRY_RECORD_SIZE];
+        memcpy(batch, ring[tail], (size_t)chunk * TELEMETRY_RECORD_SIZE);
+        ringCount -= chunk;
+        
+        unsigned char droppedRecord[TELEMETRY_RECORD_SIZE];
+        bool reportDropped = droppedRecords > 0;
+        if (reportDropped) {
+            encodeRecord(droppedRecord, TELEMETRY_DROPPED, 0, lastRecordTime, 0.0f, droppedRecords);
+            droppedRecords = 0;
+        }
+        
+        pthread_mutex_unlock(&ringMutex);
+        fwrite(batch, TELEMETRY_RECORD_SIZE, (size_t)chunk, telemetryFile);
+        if (reportDropped) {
+            fwrite(droppedRecord, 1, sizeof(droppedRecord), telemetryFile);
+        }
+        fflush(telemetryFile);
+        pthread_mutex_lock(&ringMutex);
+    }
+}
+
+static void *flushWorker(void *arg) {
+    (void)arg;
+    pthread_mutex_lock(&ringMutex);
+    
+    while (true) {
+        if (ringCount < TELEMETRY_RING_CAPACITY / 2 && !flushStopRequested) {
+            struct timespec deadline;
+            clock_gettime(CLOCK_REALTIME, &deadline);
+            deadline.tv_sec += FLUSH_INTERVAL_MS / 1000;
+            deadline.tv_nsec += (long)(FLUSH_INTERVAL_MS % 1000) * 1000000L;
+            if (deadline.tv_nsec >= 1000000000L) {
+                deadline.tv_sec++;
+                deadline.tv_nsec -= 1000000000L;
+            }
+            pthread_cond_timedwait(&flushCond, &ringMutex, &deadline);
+        }
+        
+        drainRing();
+        if (flushStopRequested) break;
+    }
+    
+    pthread_mutex_unlock(&ringMutex);
+    return NULL;
+}
+
+
+void InitTelemetry(void) {
+    if (telemetryEnabled) return;
+    
+    const char *setting = getenv("MAG_TELEMETRY");
+    if (setting == NULL || setting[0] == '\0' || strcmp(setting, "0") == 0) {
+        return;
+    }
+    
+    const char *path = (strcmp(setting, "1") == 0) ? TELEMETRY_DEFAULT_FILE : setting;
+    telemetryFile = openTelemetryFile(path);
+    if (telemetryFile == NULL) {
+        printf("AVISO: não foi possível abrir o arquivo de telemetria %s\n", path);
+        return;
+    }
+    
+    flushStopRequested = false;
+    flushThreadRunning = pthread_create(&flushThread, NULL, flushWorker, NULL) == 0;
+    if (!flushThreadRunning) {
+        printf("AVISO: thread de telemetria indisponível, telemetria desligada\n");
+        fclose(telemetryFile);
+        telemetryFile = NULL;
+        return;
+    }
+    
+    telemetryEnabled = true;
+    RecordTelemetryEvent(TELEMETRY_SESSION_START, 0, 0.0f, (unsigned int)time(NULL));
+    printf("Telemetria gravando em %s\n", path);
+}
+
+
+void ShutdownTelemetry(void) {
+    if (!telemetryEnabled) return;
+    
+    pthread_mutex_lock(&ringMutex);
+    flushStopRequested = true;
+    pthread_cond_signal(&flushCond);
+    pthread_mutex_unlock(&ringMutex);
+    pthread_join(flushThread, NULL);
+    
+    flushThreadRunning = false;
+    telemetryEnabled = false;
+    fclose(telemetryFile);
+    telemetryFile = NULL;
+}
+
+
+bool IsTelemetryEnabled(void) {
+    return telemetryEnabled;
+}
+
+
+void RecordTelemetryFrame(float gameTime, float frameTime, int enemyCount) {
+    currentGameTime = gameTime;
+    RecordTelemetryEvent(TELEMETRY_FRAME, 0, frameTime * 1000.0f, (unsigned int)enemyCount);
+}
+
+
+void RecordTelemetryEvent(TelemetryEventType type, int detail, float value, unsigned int extra) {
+    if (!telemetryEnabled) return;
+    
+    // Eventos de uma partida nova contam o tempo a partir de zero
+    if (type == TELEMETRY_RUN_START) {
+        currentGameTime = 0.0f;
+    }
+    
+    pthread_mutex_lock(&ringMutex);
+    
+    lastRecordTime = currentGameTime;
+    if (ringCount == TELEMETRY_RING_CAPACITY) {
+        // O frame nunca espera pelo disco: o registro é descartado e contado
+        droppedRecords++;
+    } else {
+        encodeRecord(ring[ringHead], type, detail, currentGameTime, value, extra);
+        ringHead = (ringHead + 1) % TELEMETRY_RING_CAPACITY;
+        ringCount++;
+        
+        if (ringCount == TELEMETRY_RING_CAPACITY / 2) {
+            pthread_cond_signal(&flushCond);
+        }
+    }
+    
+    pthread_mutex_unlock(&ringMutex);
+}
@@ -0,0 +1,57 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <stdbool.h>
+
+// Registro de eventos da simulação em binário compacto, gravado por uma thread.
+// Ativado pela variável de ambiente MAG_TELEMETRY: "1" grava em
+// TELEMETRY_DEFAULT_FILE, qualquer outro valor é usado como caminho.
+// O arquivo é lido por tools/telemetry_report.c.
+
+#define TELEMETRY_DEFAULT_FILE "telemetry.bin"
+#define TELEMETRY_FILE_MAGIC "MAGT"
+#define TELEMETRY_FILE_VERSION 1
+#define TELEMETRY_HEADER_SIZE 16
+#define TELEMETRY_RECORD_SIZE 16
+#define TELEMETRY_RING_CAPACITY 8192   // registros; cheio, os novos são descartados e contados
+
+// Formato do arquivo (little-endian):
+// Cabeçalho: "MAGT" | versão (u16) | tamanho do registro (u16) | reservado (u64)
+// Registro:  tipo (u8) | detalhe (u8) | reservado (u16) | tempo de jogo (f32) |
+//            valor (f32) | extra (u32)
+// Os valores não podem mudar de número: arquivos antigos continuam legíveis.
+typedef enum {
+    TELEMETRY_SESSION_START = 1,  // extra: hora Unix de abertura do jogo
+    TELEMETRY_RUN_START = 2,
+    TELEMETRY_RUN_END = 3,        // detalhe: TelemetryRunEnd, valor: tempo de jogo, extra: pontuação
+    TELEMETRY_FRAME = 4,          // valor: tempo do frame (ms), extra: inimigos vivos
+    TELEMETRY_KILL = 5,           // detalhe: EnemyType
+    TELEMETRY_DAMAGE = 6,         // detalhe: TelemetryDamageSource, extra: vidas restantes
+    TELEMETRY_PICKUP = 7,         // detalhe: PowerupType
+    TELEMETRY_BOSS_LAYER = 8,     // detalhe: camada em que o boss surgiu ou entrou (0 = derrotado)
+    TELEMETRY_REWARD = 9,         // detalhe: BossRewardType
+    TELEMETRY_DROPPED = 10        // extra: registros perdidos com o anel cheio
+} TelemetryEventType;
+
+typedef enum {
+    TELEMETRY_DAMAGE_ENEMY_BULLET = 0,
+    TELEMETRY_DAMAGE_ENEMY_CONTACT,
+    TELEMETRY_DAMAGE_BOSS_CONTACT,
+    TELEMETRY_DAMAGE_POWERUP_COST
+} TelemetryDamageSource;
+
+typedef enum {
+    TELEMETRY_RUN_END_GAME_OVER = 0,
+    TELEMETRY_RUN_END_ABANDONED
+} TelemetryRunEnd;
+
+void InitTelemetry(void);
+// Grava o que estiver no anel e encerra a thread
+void ShutdownTelemetry(void);
+bool IsTelemetryEnabled(void);
+
+// Amostra de frame da partida; também define o tempo de jogo dos eventos seguintes
+void RecordTelemetryFrame(float gameTime, float frameTime, int enemyCount);
+void RecordTelemetryEvent(TelemetryEventType type, int detail, float value, unsigned int extra);
+
+#endif
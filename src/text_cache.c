@@ -0,0 +1,182 @@
+#include "text_cache.h"
+#include "rlgl.h"
+#include <string.h>
+
+
+// Quad de um glifo relativo à origem do texto, já com as coordenadas de textura
+typedef struct {
+    float x, y, width, height;
+    float u0, v0, u1, v1;
+} GlyphQuad;
+
+typedef struct {
+    char text[TEXT_CACHE_MAX_LENGTH];
+    unsigned int hash;
+    int fontSize;
+    int width;
+    unsigned int textureId;
+    int quadCount;
+    GlyphQuad quads[TEXT_CACHE_MAX_LENGTH];
+    unsigned int lastUse;
+    bool used;
+} TextRun;
+
+
+static TextRun textRuns[TEXT_CACHE_SIZE];
+static unsigned int useCounter = 0;
+
+
+static unsigned int hashText(const char *text, int *length) {
+    unsigned int hash = 2166136261u;  // FNV-1a
+    int i = 0;
+    for (; text[i] != '\0'; i++) {
+        hash = (hash ^ (unsigned char)text[i]) * 16777619u;
+    }
+    *length = i;
+    return hash;
+}
+
+// Mesmo posicionamento de DrawTextEx/DrawTextCodepoint com a fonte padrão
+static void layoutRun(TextRun *run) {
+    Font font = GetFontDefault();
+    
+    float scale = (float)run->fontSize / font.baseSize;
+    float spacing = (float)(run->fontSize / 10);
+    float padding = (float)font.glyphPadding;
+    float offsetX = 0.0f;
+    
+    run->textureId = font.texture.id;
+    run->width = MeasureText(run->text, run->fontSize);
+    run->quadCount = 0;
+    
+    const char *cursor = run->text;
+    while (*cursor != '\0') {
+        int byteCount = 0;
+        int codepoint = GetCodepointNext(cursor, &byteCount);
+        int index = GetGlyphIndex(font, codepoint);
+        cursor += byteCount;
+        
+        Rectangle rec = font.recs[index];
+        GlyphInfo glyph = font.glyphs[index];
+        
+        if (codepoint != ' ' && codepoint != '\t') {
+            GlyphQuad *quad = &run->quads[run->quadCount++];
+            quad->x = offsetX + (glyph.offsetX - padding) * scale;
+            quad->y = (glyph.offsetY - padding) * scale;
+            quad->width = (rec.width + 2.0f * padding) * scale;
+            quad->height = (rec.height + 2.0f * padding) * scale;
+            quad->u0 = (rec.x - padding) / font.texture.width;
+            quad->v0 = (rec.y - padding) / font.texture.height;
+            quad->u1 = (rec.x + rec.width + padding) / font.texture.width;
+            quad->v1 = (rec.y + rec.height + padding) / font.texture.height;
+        }
+        
+        float advance = (glyph.advanceX == 0) ? rec.width : (float)glyph.advanceX;
+        offsetX += advance * scale + spacing;
+    }
+}
+
+// Busca o texto no cache; se não estiver, substitui a entrada usada há mais tempo.
+// Retorna NULL para textos que o cache não cobre (longos demais ou com quebra de linha).
+static const TextRun *getTextRun(const char *text, int fontSize) {
+    if (fontSize < 10) fontSize = 10;  // mesmo limite mínimo de DrawText
+    
+    int length = 0;
+    unsigned int hash = hashText(text, &length);
+    if (length == 0 || length >= TEXT_CACHE_MAX_LENGTH || strchr(text, '\n') != NULL) {
+        return NULL;
+    }
+    
+    useCounter++;
+    
+    TextRun *oldest = &textRuns[0];
+    for (int i = 0; i < TEXT_CACHE_SIZE; i++) {
+        TextRun *run = &textRuns[i];
+        
+        if (run->used && run->hash == hash && run->fontSize == fontSize &&
+            strcmp(run->text, text) == 0) {
+            run->lastUse = useCounter;
+            return run;
+        }
+        
+        if (!run->used || (oldest->used && run->lastUse < oldest->lastUse)) {
+            oldest = run;
+        }
+    }
+    
+    memcpy(oldest->text, text, length + 1);
+    oldest->hash = hash;
+    oldest->fontSize = fontSize;
+    oldest->lastUse = useCounter;
+    oldest->used = true;
+    layoutRun(oldest);
+    
+    return oldest;
+}
+
+static void emitQuads(const TextRun *run, float x, float y, Color color) {
+    for (int i = 0; i < run->quadCount; i++) {
+        const GlyphQuad *quad = &run->quads[i];
+        float left = x + quad->x;
+        float top = y + quad->y;
+        
+        rlColor4ub(color.r, color.g, color.b, color.a);
+        rlNormal3f(0.0f, 0.0f, 1.0f);
+        
+        rlTexCoord2f(quad->u0, quad->v0);
+        rlVertex2f(left, top);
+        rlTexCoord2f(quad->u0, quad->v1);
+        rlVertex2f(left, top + quad->height);
+        rlTexCoord2f(quad->u1, quad->v1);
+        rlVertex2f(left + quad->width, top + quad->height);
+        rlTexCoord2f(quad->u1, quad->v0);
+        rlVertex2f(left + quad->width, top);
+    }
+}
+
+
+int MeasureCachedText(const char *text, int fontSize) {
+    const TextRun *run = getTextRun(text, fontSize);
+    return (run != NULL) ? run->width : MeasureText(text, fontSize);
+}
+
+
+void DrawCachedText(const char *text, int posX, int posY, int fontSize, Color color) {
+    const TextRun *run = getTextRun(text, fontSize);
+    if (run == NULL) {
+        DrawText(text, posX, posY, fontSize, color);
+        return;
+    }
+    
+    rlCheckRenderBatchLimit(4 * run->quadCount);
+    rlSetTexture(run->textureId);
+    rlBegin(RL_QUADS);
+    emitQuads(run, (float)posX, (float)posY, color);
+    rlEnd();
+    rlSetTexture(0);
+}
+
+
+void DrawCachedTextShadow(const char *text, int posX, int posY, int fontSize, Color color,
+                          int shadowOffset, Color shadowColor) {
+    const TextRun *run = getTextRun(text, fontSize);
+    if (run == NULL) {
+        DrawText(text, posX + shadowOffset, posY + shadowOffset, fontSize, shadowColor);
+        DrawText(text, posX, posY, fontSize, color);
+        return;
+    }
+    
+    rlCheckRenderBatchLimit(8 * run->quadCount);
+    rlSetTexture(run->textureId);
+    rlBegin(RL_QUADS);
+    emitQuads(run, (float)(posX + shadowOffset), (float)(posY + shadowOffset), shadowColor);
+    emitQuads(run, (float)posX, (float)posY, color);
+    rlEnd();
+    rlSetTexture(0);
+}
+
+
+void ClearTextCache(void) {
+    memset(textRuns, 0, sizeof(textRuns));
+    useCounter = 0;
+}
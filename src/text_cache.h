@@ -0,0 +1,22 @@
+#ifndef TEXT_CACHE_H
+#define TEXT_CACHE_H
+
+#include "raylib.h"
+
+#define TEXT_CACHE_SIZE 64          // textos diferentes mantidos ao mesmo tempo
+#define TEXT_CACHE_MAX_LENGTH 96    // textos maiores são desenhados sem cache
+
+// Cache de textos já medidos e montados, indexado por (texto, tamanho).
+// Na primeira vez o texto é medido e cada glifo vira um quad pronto; nos frames
+// seguintes desenhar é só copiar esses quads para o lote do rlgl.
+// Mesmas regras de posição e tamanho de DrawText/MeasureText (fonte padrão).
+int MeasureCachedText(const char *text, int fontSize);
+void DrawCachedText(const char *text, int posX, int posY, int fontSize, Color color);
+
+// Texto com sombra deslocada, montado uma vez e enviado em um único lote
+void DrawCachedTextShadow(const char *text, int posX, int posY, int fontSize, Color color,
+                          int shadowOffset, Color shadowColor);
+
+void ClearTextCache(void);
+
+#endif
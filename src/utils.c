@@ -18,6 +18,7 @@ float targetPlayAreaRadius;
 float areaChangeTimer = 0.3f;                    
 float areaTransitionSpeed = 1.0f;                
 bool isAreaShrinking = false;                    
+static float radiusRate = 0.0f;                  // px/s do último UpdateDynamicPlayArea
 
 float PLAY_AREA_CENTER_Y = SCREEN_HEIGHT / 2.0f;  // Inicialização com valor padrão
 
@@ -69,6 +70,7 @@ void InitPlayArea(void) {
     float baseRadius = fminf(SCREEN_WIDTH, SCREEN_HEIGHT) / 2.0f - PLAY_AREA_MARGIN;
     currentPlayAreaRadius = baseRadius;  
     targetPlayAreaRadius = baseRadius;   
+    radiusRate = 0.0f;
     
     
     isAreaShrinking = false;
@@ -80,6 +82,7 @@ void InitPlayArea(void) {
 
 
 void UpdateDynamicPlayArea(float deltaTime, float gameScore) {
+    float radiusBefore = currentPlayAreaRadius;
     
     if (gameScore >= 1000) {
         areaChangeTimer += deltaTime;
@@ -98,6 +101,7 @@ void UpdateDynamicPlayArea(float deltaTime, float gameScore) {
             currentPlayAreaRadius = targetPlayAreaRadius;
         }
     }
+    radiusRate = (deltaTime > 0.0f) ? (currentPlayAreaRadius - radiusBefore) / deltaTime : 0.0f;
     
     
     if (gameScore >= 1000) {
@@ -123,3 +127,6 @@ void UpdateDynamicPlayArea(float deltaTime, float gameScore) {
     UpdateScreenSizeVars();
 }
 
+float GetPlayAreaRadiusRate(void) {
+    return radiusRate;
+}
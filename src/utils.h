@@ -55,4 +55,8 @@ void InitPlayArea(void);
 
 void UpdateDynamicPlayArea(float deltaTime, float gameScore); 
 
+// Velocidade da borda no último quadro (px/s, negativa encolhendo). O raio
+// no começo do quadro é currentPlayAreaRadius - taxa * deltaTime.
+float GetPlayAreaRadiusRate(void);
+
 #endif
\ No newline at end of file
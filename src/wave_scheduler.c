@@ -0,0 +1,124 @@
+#include "wave_scheduler.h"
+#include "spawn_table.h"
+#include <math.h>
+
+
+static bool heapBefore(const SpawnEvent *a, const SpawnEvent *b) {
+    return a->time < b->time;
+}
+
+static void heapPush(WaveScheduler *waves, SpawnEvent event) {
+    int index = waves->count++;
+    while (index > 0) {
+        int parent = (index - 1) / 2;
+        if (!heapBefore(&event, &waves->events[parent])) break;
+        waves->events[index] = waves->events[parent];
+        index = parent;
+    }
+    waves->events[index] = event;
+}
+
+static SpawnEvent heapPop(WaveScheduler *waves) {
+    SpawnEvent top = waves->events[0];
+    SpawnEvent last = waves->events[--waves->count];
+    
+    int index = 0;
+    for (;;) {
+        int child = index * 2 + 1;
+        if (child >= waves->count) break;
+        if (child + 1 < waves->count && heapBefore(&waves->events[child + 1], &waves->events[child])) child++;
+        if (!heapBefore(&waves->events[child], &last)) break;
+        waves->events[index] = waves->events[child];
+        index = child;
+    }
+    if (waves->count > 0) {
+        waves->events[index] = last;
+    }
+    return top;
+}
+
+// Intervalo regular na dificuldade de um instante do relógio de spawn.
+// Mesma curva do antigo UpdateDifficulty, só que sem depender do quadro.
+static float intervalAt(const WaveScheduler *waves, float spawnTime) {
+    float difficultyTime = spawnTime + waves->pausedTime;
+    float interval = WAVE_INITIAL_INTERVAL * powf(WAVE_INTERVAL_DECAY, floorf(difficultyTime / WAVE_DECAY_PERIOD));
+    return (interval < WAVE_MIN_INTERVAL) ? WAVE_MIN_INTERVAL : interval;
+}
+
+static SpawnEvent rollEvent(float time, long score) {
+    SpawnSpec spec = RollSpawn(score);
+    SpawnEvent event;
+    event.time = time;
+    event.type = spec.type;
+    event.radius = spec.radius;
+    event.speed = spec.speed;
+    event.side = (int)(SpawnRandomUnit() * 4.0f);
+    event.along = SpawnRandomUnit();
+    return event;
+}
+
+// Rajada inteira de uma vez, espalhada em volta de um ponto da mesma borda
+static void scheduleBurst(WaveScheduler *waves, const SpawnBurst *burst, int count, long score) {
+    int side = (int)(SpawnRandomUnit() * 4.0f);
+    float center = 0.2f + SpawnRandomUnit() * 0.6f;
+    for (int i = 0; i < count; i++) {
+        SpawnEvent event = rollEvent(waves->nextBurstTime + i * burst->spacing, score);
+        event.side = side;
+        event.along = center + (SpawnRandomUnit() - 0.5f) * 0.3f;
+        heapPush(waves, event);
+    }
+    
+    waves->nextBurstTime += burst->period;
+}
+
+
+void ResetWaveScheduler(WaveScheduler *waves) {
+    waves->count = 0;
+    waves->clock = 0.0f;
+    waves->pausedTime = 0.0f;
+    waves->nextSpawnTime = WAVE_INITIAL_INTERVAL;
+    
+    SpawnBurst burst = GetSpawnBurst();
+    waves->nextBurstTime = (burst.period > 0.0f) ? burst.period : INFINITY;
+}
+
+
+void UpdateWaveScheduler(WaveScheduler *waves, float deltaTime, bool paused, long score) {
+    if (paused) {
+        waves->pausedTime += deltaTime;
+        return;
+    }
+    
+    waves->clock += deltaTime;
+    
+    // Completa a janela aos poucos: o custo do sorteio fica diluído nos quadros
+    // em vez de concentrado no quadro do spawn
+    SpawnBurst burst = GetSpawnBurst();
+    int burstCount = (burst.count > WAVE_QUEUE_CAPACITY / 2) ? WAVE_QUEUE_CAPACITY / 2 : burst.count;
+    float horizon = waves->clock + WAVE_LOOKAHEAD;
+    int generated = 0;
+    while (generated < WAVE_REFILL_PER_TICK) {
+        if (waves->nextBurstTime <= waves->nextSpawnTime) {
+            if (waves->nextBurstTime > horizon) break;
+            if (waves->count + burstCount > WAVE_QUEUE_CAPACITY) break;
+            scheduleBurst(waves, &burst, burstCount, score);
+            generated += burstCount;
+        } else {
+            if (waves->nextSpawnTime > horizon) break;
+            if (waves->count == WAVE_QUEUE_CAPACITY) break;
+            heapPush(waves, rollEvent(waves->nextSpawnTime, score));
+            waves->nextSpawnTime += intervalAt(waves, waves->nextSpawnTime);
+            generated++;
+        }
+    }
+}
+
+
+bool PopDueSpawn(WaveScheduler *waves, SpawnEvent *event) {
+    if (waves->count == 0 || waves->events[0].time > waves->clock) {
+        return false;
+    }
+    
+    *event = heapPop(waves);
+    return true;
+}
@@ -0,0 +1,48 @@
+#ifndef WAVE_SCHEDULER_H
+#define WAVE_SCHEDULER_H
+
+#include <stdbool.h>
+#include "enemy.h"
+
+#define WAVE_QUEUE_CAPACITY 64
+#define WAVE_LOOKAHEAD 2.0f          // segundos de spawns já sorteados à frente
+#define WAVE_REFILL_PER_TICK 8       // eventos sorteados por quadro, no máximo
+#define WAVE_SPAWNS_PER_TICK 3       // inimigos criados por quadro, no máximo
+
+// Curva de dificuldade: o intervalo cai 10% a cada 10 s, até o mínimo
+#define WAVE_INITIAL_INTERVAL 1.5f
+#define WAVE_INTERVAL_DECAY 0.90f
+#define WAVE_DECAY_PERIOD 10.0f
+#define WAVE_MIN_INTERVAL 0.2f
+
+// Um spawn já sorteado. A posição final é calculada na hora de criar o
+// inimigo, porque a área de jogo muda de tamanho durante a partida.
+typedef struct {
+    float time;              // no relógio de spawn
+    EnemyType type;
+    float radius;
+    float speed;
+    int side;                // 0 cima, 1 baixo, 2 esquerda, 3 direita
+    float along;             // posição ao longo da borda, de 0 a 1
+} SpawnEvent;
+
+// Fila de prioridade (heap por tempo) com a próxima janela de spawns
+typedef struct {
+    SpawnEvent events[WAVE_QUEUE_CAPACITY];
+    int count;
+    float clock;             // relógio de spawn (parado durante o boss)
+    float pausedTime;        // tempo parado, que ainda conta para a dificuldade
+    float nextSpawnTime;     // próximo spawn regular ainda não sorteado
+    float nextBurstTime;     // próxima rajada ainda não sorteada
+} WaveScheduler;
+
+void ResetWaveScheduler(WaveScheduler *waves);
+
+// Avança o relógio e completa a janela à frente (até WAVE_REFILL_PER_TICK eventos).
+// Com paused os spawns ficam congelados, mas a dificuldade continua subindo.
+void UpdateWaveScheduler(WaveScheduler *waves, float deltaTime, bool paused, long score);
+
+// Retira o próximo spawn vencido; false quando não há nenhum
+bool PopDueSpawn(WaveScheduler *waves, SpawnEvent *event);
+
+#endif
@@ -0,0 +1,181 @@
+// Conversor e medidor de formatos de música.
+//
+// Uso: audio_bench [--convert] <pasta_de_musicas> <manifesto>
+//
+// Para cada .wav da pasta:
+//   --convert  gera a variante .qoa ao lado do .wav (a .ogg vem de "make music-ogg")
+//   mede, para cada variante existente (.wav/.ogg/.qoa), o custo de I/O
+//   (bytes por segundo de áudio) e o custo de CPU da decodificação
+//   (ms por segundo de áudio)
+// e escreve no manifesto o formato escolhido para cada faixa: a menor variante
+// cuja decodificação cabe no orçamento de CPU do stream. O jogo lê o manifesto
+// para decidir qual arquivo carregar, e o empacotador só inclui a escolhida.
+//
+// O I/O é medido pelo tamanho e não por tempo: os arquivos acabaram de ser
+// escritos ou lidos, então cronometrar a leitura só mediria o cache de páginas.
+
+#define _POSIX_C_SOURCE 200809L
+#include "raylib.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <dirent.h>
+
+// Orçamento de decodificação: ms de CPU por segundo de música tocada.
+// Acima disso o stream corre risco de atrasar o preenchimento do buffer.
+#define DECODE_BUDGET_MS_PER_SECOND 2.0
+#define BENCH_RUNS 3
+
+typedef struct {
+    const char *ext;
+    bool present;
+    long sizeBytes;
+    double decodeMs;
+    double durationSeconds;
+} VariantStats;
+
+static const char *variantExts[] = { "wav", "ogg", "qoa" };
+#define VARIANT_COUNT 3
+
+static double nowMs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
+
+static void replaceExtension(char *out, size_t outSize, const char *path, const char *ext) {
+    snprintf(out, outSize, "%s", path);
+    char *dot = strrchr(out, '.');
+    if (dot) *dot = '\0';
+    strncat(out, ".", outSize - strlen(out) - 1);
+    strncat(out, ext, outSize - strlen(out) - 1);
+}
+
+// Decodifica o arquivo inteiro algumas vezes e guarda o melhor tempo
+static void measureVariant(const char *path, VariantStats *stats) {
+    stats->present = FileExists(path);
+    if (!stats->present) return;
+
+    stats->decodeMs = 1e9;
+
+    for (int run = 0; run < BENCH_RUNS; run++) {
+        int size = 0;
+        unsigned char *data = LoadFileData(path, &size);
+        if (data == NULL) {
+            stats->present = false;
+            return;
+        }
+
+        double start = nowMs();
+        Wave wave = LoadWaveFromMemory(GetFileExtension(path), data, size);
+        double afterDecode = nowMs();
+
+        stats->sizeBytes = size;
+        if (afterDecode - start < stats->decodeMs) stats->decodeMs = afterDecode - start;
+        if (wave.sampleRate > 0) stats->durationSeconds = (double)wave.frameCount / wave.sampleRate;
+
+        UnloadWave(wave);
+        UnloadFileData(data);
+    }
+
+    if (stats->durationSeconds <= 0.0) stats->present = false;
+}
+
+static bool convertToQoa(const char *wavPath) {
+    char qoaPath[1024];
+    replaceExtension(qoaPath, sizeof(qoaPath), wavPath, "qoa");
+
+    Wave wave = LoadWave(wavPath);
+    if (wave.data == NULL) return false;
+
+    // QOA só aceita amostras de 16 bits
+    if (wave.sampleSize != 16) WaveFormat(&wave, wave.sampleRate, 16, wave.channels);
+
+    bool ok = ExportWave(wave, qoaPath);
+    UnloadWave(wave);
+    return ok;
+}
+
+int main(int argc, char **argv) {
+    bool convert = false;
+    int argIndex = 1;
+    if (argc > 1 && strcmp(argv[1], "--convert") == 0) {
+        convert = true;
+        argIndex++;
+    }
+
+    if (argc - argIndex != 2) {
+        fprintf(stderr, "Uso: %s [--convert] <pasta_de_musicas> <manifesto>\n", argv[0]);
+        return 1;
+    }
+
+    const char *musicDir = argv[argIndex];
+    const char *manifestPath = argv[argIndex + 1];
+
+    SetTraceLogLevel(LOG_WARNING);
+
+    DIR *dir = opendir(musicDir);
+    if (!dir) {
+        fprintf(stderr, "Não foi possível abrir a pasta %s\n", musicDir);
+        return 1;
+    }
+
+    FILE *manifest = fopen(manifestPath, "w");
+    if (!manifest) {
+        fprintf(stderr, "Não foi possível criar %s\n", manifestPath);
+        closedir(dir);
+        return 1;
+    }
+    fprintf(manifest, "# Formato escolhido por faixa (gerado por tools/audio_bench)\n");
+    fprintf(manifest, "# <caminho do .wav original>=<extensão carregada>\n");
+
+    printf("%-40s %-4s %10s %10s %12s\n",
+           "faixa", "fmt", "KB", "KB/s", "decod ms/s");
+
+    struct dirent *item;
+    while ((item = readdir(dir)) != NULL) {
+        if (item->d_name[0] == '.' || !IsFileExtension(item->d_name, ".wav")) continue;
+
+        char wavPath[1024];
+        snprintf(wavPath, sizeof(wavPath), "%s/%s", musicDir, item->d_name);
+
+        if (convert && !convertToQoa(wavPath)) {
+            fprintf(stderr, "Falha ao converter %s para QOA\n", wavPath);
+        }
+
+        VariantStats stats[VARIANT_COUNT] = {0};
+        int chosen = 0;  // .wav sempre é a variante de segurança
+
+        for (int v = 0; v < VARIANT_COUNT; v++) {
+            char variantPath[1024];
+            replaceExtension(variantPath, sizeof(variantPath), wavPath, variantExts[v]);
+            stats[v].ext = variantExts[v];
+            measureVariant(variantPath, &stats[v]);
+            if (!stats[v].present) continue;
+
+            double bytesPerSecond = stats[v].sizeBytes / stats[v].durationSeconds;
+            double decodePerSecond = stats[v].decodeMs / stats[v].durationSeconds;
+
+            printf("%-40.40s %-4s %10ld %10.1f %12.3f\n",
+                   item->d_name, variantExts[v], stats[v].sizeBytes / 1024,
+                   bytesPerSecond / 1024.0, decodePerSecond);
+
+            // Menor arquivo que ainda decodifica dentro do orçamento
+            if (decodePerSecond <= DECODE_BUDGET_MS_PER_SECOND &&
+                (!stats[chosen].present || stats[v].sizeBytes < stats[chosen].sizeBytes)) {
+                chosen = v;
+            }
+        }
+
+        if (stats[chosen].present) {
+            printf("  -> %s\n", variantExts[chosen]);
+            fprintf(manifest, "%s=%s\n", wavPath, variantExts[chosen]);
+        }
+    }
+
+    closedir(dir);
+    fclose(manifest);
+    printf("Manifesto escrito em %s\n", manifestPath);
+    return 0;
+}
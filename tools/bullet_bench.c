@@ -0,0 +1,237 @@
+// Medidor das balas teleguiadas e penetrantes.
+//
+// Uso: bullet_bench
+//
+// Roda sem janela nem áudio. Monta inimigos parados na arena (100, 500 e 1000)
+// e mede o custo médio por quadro de:
+//   - busca do alvo mais perto: FindNearestEnemy (grade) contra uma varredura
+//     linear da lista, conferindo que as duas acham o mesmo alvo
+//   - UpdateBullets com BENCH_BULLETS balas teleguiadas e com balas comuns
+//   - HandleCollisions com BENCH_BULLETS balas penetrantes e com balas comuns,
+//     mais uma varredura linear só de sobreposição como piso de referência
+// Os inimigos têm vida de sobra para ninguém morrer entre os quadros, e cada
+// quadro parte das mesmas balas.
+
+#define _POSIX_C_SOURCE 200809L
+#include "game.h"
+#include "direction_table.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <math.h>
+#include <time.h>
+
+#define BENCH_BULLETS 500
+#define BENCH_FRAMES 200
+#define BENCH_ENEMY_RADIUS 20.0f
+
+extern float currentPlayAreaRadius;
+
+static const int enemyCounts[] = { 100, 500, 1000 };
+#define ENEMY_COUNT_CASES 3
+
+static Game game;    // grande demais para a pilha
+static Vector2 bulletOrigins[BENCH_BULLETS];
+static Bullet bulletSnapshot[BENCH_BULLETS];
+
+static double nowMs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
+
+static Vector2 randomArenaPoint(void) {
+    float angle = GetRandomValue(0, 3599) * 0.1f * DEG2RAD;
+    float distance = sqrtf(GetRandomValue(0, 1000) / 1000.0f) * currentPlayAreaRadius * 0.9f;
+    return (Vector2){
+        PLAY_AREA_CENTER_X + cosf(angle) * distance,
+        PLAY_AREA_CENTER_Y + sinf(angle) * distance
+    };
+}
+
+// Referência: o mesmo alvo que a grade deve achar, olhando todos os inimigos
+static bool scanNearestEnemy(Vector2 position, float range, Vector2 *target) {
+    float bestSqr = range * range;
+    bool found = false;
+    for (const Enemy *enemy = game.enemies.head; enemy != NULL; enemy = enemy->next) {
+        if (!enemy->active) continue;
+        float dx = enemy->position.x - position.x;
+        float dy = enemy->position.y - position.y;
+        float distanceSqr = dx * dx + dy * dy;
+        if (distanceSqr < bestSqr) {
+            bestSqr = distanceSqr;
+            *target = enemy->position;
+            found = true;
+        }
+    }
+    return found;
+}
+
+// Piso das colisões: só conta sobreposições bala x inimigo, sem acertos nem remoção
+static int scanOverlaps(const BulletList *bullets) {
+    int overlaps = 0;
+    for (int b = 0; b < bullets->count; b++) {
+        const Bullet *bullet = &bullets->items[b];
+        for (const Enemy *enemy = game.enemies.head; enemy != NULL; enemy = enemy->next) {
+            if (CheckCollisionCircles(bullet->position, bullet->radius, enemy->position, enemy->radius)) {
+                overlaps++;
+            }
+        }
+    }
+    return overlaps;
+}
+
+static void spawnEnemies(int count) {
+    FreeEnemies(&game.enemies);
+    InitEnemyList(&game.enemies);
+    for (int i = 0; i < count; i++) {
+        AddEnemy(&game.enemies, randomArenaPoint(), BENCH_ENEMY_RADIUS, 0.0f, DARKGRAY, ENEMY_TYPE_TANK);
+    }
+    for (Enemy *enemy = game.enemies.head; enemy != NULL; enemy = enemy->next) {
+        enemy->health = INT_MAX / 2;
+    }
+
+    // Quadro parado só para montar a grade de broadphase
+    UpdateEnemies(&game.enemies, game.player.position, 0.0f, SCREEN_WIDTH, SCREEN_HEIGHT,
+                  &game.bullets, &game.enemyBullets);
+}
+
+static void emitBenchBullets(BulletKind kind) {
+    ClearBullets(&game.bullets);
+    for (int i = 0; i < BENCH_BULLETS; i++) {
+        float angle = GetRandomValue(0, 3599) * 0.1f * DEG2RAD;
+        Vector2 direction = { cosf(angle), sinf(angle) };
+        EmitBullets(&game.bullets, GetBulletArchetype(kind), BULLET_NO_MODIFIERS,
+                    bulletOrigins[i], &direction, 1);
+    }
+    memcpy(bulletSnapshot, game.bullets.items, BENCH_BULLETS * sizeof(Bullet));
+}
+
+static void restoreBullets(void) {
+    memcpy(game.bullets.items, bulletSnapshot, BENCH_BULLETS * sizeof(Bullet));
+    game.bullets.count = BENCH_BULLETS;
+}
+
+static double timeUpdateBullets(BulletKind kind) {
+    emitBenchBullets(kind);
+    double total = 0.0;
+    for (int frame = 0; frame < BENCH_FRAMES; frame++) {
+        restoreBullets();
+        double start = nowMs();
+        UpdateBullets(&game.bullets, 1.0f / 60.0f, SCREEN_WIDTH, SCREEN_HEIGHT);
+        total += nowMs() - start;
+    }
+    return total / BENCH_FRAMES;
+}
+
+static double timeHandleCollisions(BulletKind kind, int *hits) {
+    emitBenchBullets(kind);
+    double total = 0.0;
+    for (int frame = 0; frame < BENCH_FRAMES; frame++) {
+        restoreBullets();
+        double start = nowMs();
+        HandleCollisions(&game);
+        total += nowMs() - start;
+    }
+
+    // Acertos do último quadro: os anotados no conjunto mais o que apagou a bala
+    *hits = 0;
+    for (int b = 0; b < game.bullets.count; b++) {
+        *hits += game.bullets.items[b].hitCount + !game.bullets.items[b].active;
+    }
+    return total / BENCH_FRAMES;
+}
+
+int main(void) {
+    SetTraceLogLevel(LOG_WARNING);
+    SetRandomSeed(12345);
+
+    InitPlayArea();
+    // Sem janela GetScreenHeight é 0: centralizar a arena na resolução base
+    PLAY_AREA_CENTER_Y = SCREEN_HEIGHT / 2.0f;
+    InitDirectionTables();
+
+    InitEnemyList(&game.enemies);
+    InitBulletList(&game.bullets);
+    InitBulletList(&game.enemyBullets);
+    InitPowerups(&game.powerups);
+    // Jogador longe e invencível: só as colisões das balas do jogador contam
+    game.player.position = (Vector2){ -10000.0f, -10000.0f };
+    game.player.isInvincible = true;
+    game.player.lives = 3;
+    game.currentState = GAME_STATE_PLAYING;
+
+    for (int i = 0; i < BENCH_BULLETS; i++) {
+        bulletOrigins[i] = randomArenaPoint();
+    }
+
+    printf("%d balas, média de %d quadros\n\n", BENCH_BULLETS, BENCH_FRAMES);
+    printf("%-8s | %-25s | %-21s | %-34s\n", "", "alvo mais perto (ms)", "UpdateBullets (ms)", "HandleCollisions (ms)");
+    printf("%-8s | %8s %8s %7s | %10s %10s | %10s %10s %12s\n",
+           "inimigos", "grade", "linear", "erros", "teleguiada", "comum",
+           "penetrante", "comum", "sobreposição");
+
+    for (int c = 0; c < ENEMY_COUNT_CASES; c++) {
+        spawnEnemies(enemyCounts[c]);
+
+        // A grade tem que achar exatamente o alvo da varredura
+        int mismatches = 0;
+        for (int i = 0; i < BENCH_BULLETS; i++) {
+            Vector2 gridTarget = { 0 };
+            Vector2 scanTarget = { 0 };
+            bool gridFound = FindNearestEnemy(bulletOrigins[i], HOMING_RANGE, &gridTarget);
+            bool scanFound = scanNearestEnemy(bulletOrigins[i], HOMING_RANGE, &scanTarget);
+            if (gridFound != scanFound ||
+                (gridFound && (gridTarget.x != scanTarget.x || gridTarget.y != scanTarget.y))) {
+                mismatches++;
+            }
+        }
+
+        double start = nowMs();
+        for (int frame = 0; frame < BENCH_FRAMES; frame++) {
+            for (int i = 0; i < BENCH_BULLETS; i++) {
+                Vector2 target;
+                FindNearestEnemy(bulletOrigins[i], HOMING_RANGE, &target);
+            }
+        }
+        double gridMs = (nowMs() - start) / BENCH_FRAMES;
+
+        start = nowMs();
+        for (int frame = 0; frame < BENCH_FRAMES; frame++) {
+            for (int i = 0; i < BENCH_BULLETS; i++) {
+                Vector2 target;
+                scanNearestEnemy(bulletOrigins[i], HOMING_RANGE, &target);
+            }
+        }
+        double scanMs = (nowMs() - start) / BENCH_FRAMES;
+
+        double homingMs = timeUpdateBullets(BULLET_KIND_HOMING);
+        double standardMs = timeUpdateBullets(BULLET_KIND_STANDARD);
+
+        int piercingHits = 0;
+        int standardHits = 0;
+        double piercingMs = timeHandleCollisions(BULLET_KIND_PENETRATING, &piercingHits);
+        double standardCollisionMs = timeHandleCollisions(BULLET_KIND_STANDARD, &standardHits);
+
+        // O piso usa as mesmas balas penetrantes, sem tirar nenhuma
+        emitBenchBullets(BULLET_KIND_PENETRATING);
+        int overlaps = 0;
+        start = nowMs();
+        for (int frame = 0; frame < BENCH_FRAMES; frame++) {
+            overlaps += scanOverlaps(&game.bullets);
+        }
+        double overlapMs = (nowMs() - start) / BENCH_FRAMES;
+
+        printf("%-8d | %8.3f %8.3f %7d | %10.3f %10.3f | %10.3f %10.3f %12.3f\n",
+               enemyCounts[c], gridMs, scanMs, mismatches, homingMs, standardMs,
+               piercingMs, standardCollisionMs, overlapMs);
+        printf("%-8s   acertos por quadro: penetrante %d, comum %d, sobreposições %d\n",
+               "", piercingHits, standardHits, overlaps / BENCH_FRAMES);
+    }
+
+    FreeEnemies(&game.enemies);
+    FreeBullets(&game.bullets);
+    FreeBullets(&game.enemyBullets);
+    return 0;
+}
@@ -0,0 +1,216 @@
+// Empacotador de assets: junta todos os arquivos de uma pasta em um único
+// arquivo indexado (assets.pak) que o jogo mapeia em memória na inicialização.
+//
+// Uso: pack_assets <pasta_de_assets> <arquivo_saida.pak>
+//
+// Formato (todos os inteiros em little-endian):
+//   Cabeçalho: "MAGP" | versão (u32) | quantidade de entradas (u32) | reservado (u32)
+//   Índice:    quantidade * { caminho[120] | offset (u32) | tamanho (u32) }
+//   Dados:     conteúdo dos arquivos, cada um alinhado a 16 bytes
+// O índice é gravado ordenado pelo caminho para permitir busca binária.
+//
+// Se existir o manifesto de formatos de música (gerado por "make music"), só a
+// variante escolhida de cada faixa (.wav, .ogg ou .qoa) entra no pacote.
+
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <dirent.h>
+#include <sys/stat.h>
+
+#define PACK_MAGIC "MAGP"
+#define PACK_VERSION 1
+#define PACK_PATH_LENGTH 120
+#define PACK_HEADER_SIZE 16
+#define PACK_ENTRY_SIZE (PACK_PATH_LENGTH + 8)
+#define PACK_ALIGNMENT 16
+#define MUSIC_FORMATS_NAME "music/music_formats.txt"
+#define MAX_MUSIC_FORMATS 32
+
+typedef struct {
+    char path[PACK_PATH_LENGTH];
+    uint32_t offset;
+    uint32_t size;
+} PackEntry;
+
+static PackEntry *entries = NULL;
+static int entryCount = 0;
+static int entryCapacity = 0;
+
+// Caminho do .wav original de cada faixa e a extensão escolhida para ela
+static char musicPaths[MAX_MUSIC_FORMATS][PACK_PATH_LENGTH];
+static char musicExts[MAX_MUSIC_FORMATS][8];
+static int musicFormatCount = 0;
+
+static void loadMusicFormats(const char *assetsDir) {
+    char manifestPath[1024];
+    snprintf(manifestPath, sizeof(manifestPath), "%s/%s", assetsDir, MUSIC_FORMATS_NAME);
+
+    FILE *file = fopen(manifestPath, "r");
+    if (!file) return;
+
+    char line[PACK_PATH_LENGTH + 16];
+    while (fgets(line, sizeof(line), file) && musicFormatCount < MAX_MUSIC_FORMATS) {
+        if (line[0] == '#') continue;
+        line[strcspn(line, "\r\n")] = '\0';
+
+        char *separator = strrchr(line, '=');
+        if (!separator || separator - line >= PACK_PATH_LENGTH || strlen(separator + 1) >= 8) continue;
+
+        *separator = '\0';
+        strcpy(musicPaths[musicFormatCount], line);
+        strcpy(musicExts[musicFormatCount], separator + 1);
+        musicFormatCount++;
+    }
+
+    fclose(file);
+}
+
+// Variantes não escolhidas de uma faixa ficam fora do pacote
+static int isUnusedMusicVariant(const char *path) {
+    const char *ext = strrchr(path, '.');
+    if (!ext) return 0;
+
+    for (int i = 0; i < musicFormatCount; i++) {
+        const char *originalExt = strrchr(musicPaths[i], '.');
+        size_t baseLength = originalExt ? (size_t)(originalExt - musicPaths[i]) : strlen(musicPaths[i]);
+
+        if (strlen(path) - strlen(ext) == baseLength && strncmp(path, musicPaths[i], baseLength) == 0) {
+            int isVariant = strcmp(ext, ".wav") == 0 || strcmp(ext, ".ogg") == 0 || strcmp(ext, ".qoa") == 0;
+            return isVariant && strcmp(ext + 1, musicExts[i]) != 0;
+        }
+    }
+
+    return 0;
+}
+
+static void writeU32(FILE *file, uint32_t value) {
+    unsigned char bytes[4] = {
+        value & 0xFF, (value >> 8) & 0xFF, (value >> 16) & 0xFF, (value >> 24) & 0xFF
+    };
+    fwrite(bytes, 1, 4, file);
+}
+
+static int compareEntries(const void *a, const void *b) {
+    return strcmp(((const PackEntry *)a)->path, ((const PackEntry *)b)->path);
+}
+
+// Percorre a pasta recursivamente registrando cada arquivo regular
+static int collectFiles(const char *dirPath) {
+    DIR *dir = opendir(dirPath);
+    if (!dir) {
+        fprintf(stderr, "Não foi possível abrir a pasta %s\n", dirPath);
+        return 0;
+    }
+
+    struct dirent *item;
+    while ((item = readdir(dir)) != NULL) {
+        // Ignorar ".", ".." e arquivos ocultos (.DS_Store etc.)
+        if (item->d_name[0] == '.') continue;
+
+        char fullPath[1024];
+        snprintf(fullPath, sizeof(fullPath), "%s/%s", dirPath, item->d_name);
+
+        struct stat info;
+        if (stat(fullPath, &info) != 0) continue;
+
+        if (S_ISDIR(info.st_mode)) {
+            if (!collectFiles(fullPath)) {
+                closedir(dir);
+                return 0;
+            }
+        } else if (S_ISREG(info.st_mode)) {
+            if (isUnusedMusicVariant(fullPath)) continue;
+
+            if (strlen(fullPath) >= PACK_PATH_LENGTH) {
+                fprintf(stderr, "Caminho muito longo para o pacote: %s\n", fullPath);
+                closedir(dir);
+                return 0;
+            }
+
+            if (entryCount == entryCapacity) {
+                entryCapacity = entryCapacity ? entryCapacity * 2 : 32;
+                PackEntry *grown = realloc(entries, entryCapacity * sizeof(PackEntry));
+                if (!grown) {
+                    closedir(dir);
+                    return 0;
+                }
+                entries = grown;
+            }
+
+            PackEntry *entry = &entries[entryCount++];
+            memset(entry, 0, sizeof(PackEntry));
+            strcpy(entry->path, fullPath);
+            entry->size = (uint32_t)info.st_size;
+        }
+    }
+
+    closedir(dir);
+    return 1;
+}
+
+int main(int argc, char **argv) {
+    if (argc != 3) {
+        fprintf(stderr, "Uso: %s <pasta_de_assets> <arquivo_saida.pak>\n", argv[0]);
+        return 1;
+    }
+
+    loadMusicFormats(argv[1]);
+    if (!collectFiles(argv[1])) return 1;
+
+    qsort(entries, entryCount, sizeof(PackEntry), compareEntries);
+
+    // Calcular offsets: dados começam logo após o índice, alinhados
+    uint32_t offset = PACK_HEADER_SIZE + entryCount * PACK_ENTRY_SIZE;
+    for (int i = 0; i < entryCount; i++) {
+        offset = (offset + PACK_ALIGNMENT - 1) & ~(uint32_t)(PACK_ALIGNMENT - 1);
+        entries[i].offset = offset;
+        offset += entries[i].size;
+    }
+
+    FILE *out = fopen(argv[2], "wb");
+    if (!out) {
+        fprintf(stderr, "Não foi possível criar %s\n", argv[2]);
+        return 1;
+    }
+
+    fwrite(PACK_MAGIC, 1, 4, out);
+    writeU32(out, PACK_VERSION);
+    writeU32(out, (uint32_t)entryCount);
+    writeU32(out, 0);
+
+    for (int i = 0; i < entryCount; i++) {
+        fwrite(entries[i].path, 1, PACK_PATH_LENGTH, out);
+        writeU32(out, entries[i].offset);
+        writeU32(out, entries[i].size);
+    }
+
+    unsigned char buffer[64 * 1024];
+    for (int i = 0; i < entryCount; i++) {
+        // Preencher com zeros até o offset alinhado
+        while ((uint32_t)ftell(out) < entries[i].offset) fputc(0, out);
+
+        FILE *in = fopen(entries[i].path, "rb");
+        if (!in) {
+            fprintf(stderr, "Não foi possível ler %s\n", entries[i].path);
+            fclose(out);
+            return 1;
+        }
+
+        size_t bytesRead;
+        while ((bytesRead = fread(buffer, 1, sizeof(buffer), in)) > 0) {
+            fwrite(buffer, 1, bytesRead, out);
+        }
+        fclose(in);
+
+        printf("  %-70s %10u bytes\n", entries[i].path, entries[i].size);
+    }
+
+    fclose(out);
+    printf("Pacote %s criado com %d arquivos\n", argv[2], entryCount);
+
+    free(entries);
+    return 0;
+}
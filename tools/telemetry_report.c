@@ -0,0 +1,382 @@
+// Relatório da telemetria gravada pelo jogo (MAG_TELEMETRY=1).
+//
+// Uso: telemetry_report [--spike ms] [--window s] <telemetry.bin> [mais arquivos...]
+//
+// Junta todas as sessões e partidas dos arquivos e mostra:
+//   - histograma do tempo de frame e percentis
+//   - tempo de frame por quantidade de inimigos e por minuto de partida
+//   - contagem de eventos (kills por tipo, dano por origem, power-ups,
+//     camadas do boss, recompensas, registros descartados)
+//   - correlação com picos: quantos eventos de cada tipo acontecem em volta
+//     de um frame lento, comparado com a média da partida
+// Um pico é um frame acima de --spike ms (padrão: o dobro da mediana).
+
+#include "telemetry.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define HISTOGRAM_BUCKET_MS 0.5f
+#define HISTOGRAM_BUCKETS 200          // até 100 ms; o resto vai para o último
+#define ENEMY_BUCKET_SIZE 5
+#define ENEMY_BUCKETS 21               // 0..99 e 100+
+#define MINUTE_BUCKETS 16              // 0..14 min e 15+
+#define EVENT_TYPE_COUNT 11
+#define DETAIL_COUNT 8
+#define BAR_WIDTH 50
+
+typedef struct {
+    uint8_t type;
+    uint8_t detail;
+    float time;
+    float value;
+    uint32_t extra;
+} Record;
+
+typedef struct {
+    long frames;
+    double sumMs;
+    float worstMs;
+    long spikes;
+} FrameBucket;
+
+static Record *records = NULL;
+static long recordCount = 0;
+static long recordCapacity = 0;
+
+static long histogram[HISTOGRAM_BUCKETS + 1];
+static FrameBucket byEnemies[ENEMY_BUCKETS];
+static FrameBucket byMinute[MINUTE_BUCKETS];
+static long eventCounts[EVENT_TYPE_COUNT][DETAIL_COUNT];
+static long droppedTotal = 0;
+static long sessions = 0;
+static long runs = 0;
+
+static const char *enemyNames[] = { "normal", "speeder", "tank", "exploder", "shooter" };
+static const char *damageNames[] = { "bala inimiga", "contato inimigo", "contato boss", "custo power-up" };
+static const char *powerupNames[] = { "dano", "cura", "escudo" };
+static const char *rewardNames[] = { "nenhuma", "tiro duplo", "disparo rápido", "quicante", "tiro triplo", "teleguiado", "penetrante" };
+static const char *eventNames[EVENT_TYPE_COUNT] = {
+    "?", "sessão", "início", "fim", "frame", "kill", "dano", "power-up", "camada boss", "recompensa", "descarte"
+};
+
+static uint16_t getU16(const unsigned char *in) {
+    return (uint16_t)(in[0] | (in[1] << 8));
+}
+
+static uint32_t getU32(const unsigned char *in) {
+    return (uint32_t)in[0] | ((uint32_t)in[1] << 8) | ((uint32_t)in[2] << 16) | ((uint32_t)in[3] << 24);
+}
+
+static float getF32(const unsigned char *in) {
+    uint32_t bits = getU32(in);
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+static bool appendRecord(const Record *record) {
+    if (recordCount == recordCapacity) {
+        long newCapacity = recordCapacity ? recordCapacity * 2 : 65536;
+        Record *grown = realloc(records, newCapacity * sizeof(Record));
+        if (!grown) return false;
+        records = grown;
+        recordCapacity = newCapacity;
+    }
+    records[recordCount++] = *record;
+    return true;
+}
+
+static bool loadFile(const char *path) {
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        fprintf(stderr, "Não foi possível abrir %s\n", path);
+        return false;
+    }
+
+    unsigned char header[TELEMETRY_HEADER_SIZE];
+    if (fread(header, 1, sizeof(header), file) != sizeof(header) ||
+        memcmp(header, TELEMETRY_FILE_MAGIC, 4) != 0) {
+        fprintf(stderr, "%s não é um arquivo de telemetria\n", path);
+        fclose(file);
+        return false;
+    }
+    if (getU16(header + 4) > TELEMETRY_FILE_VERSION || getU16(header + 6) < TELEMETRY_RECORD_SIZE) {
+        fprintf(stderr, "%s: versão %u não suportada\n", path, getU16(header + 4));
+        fclose(file);
+        return false;
+    }
+
+    // Registros de versões futuras podem ser maiores: ler o tamanho do cabeçalho
+    size_t recordSize = getU16(header + 6);
+    unsigned char raw[256];
+    if (recordSize > sizeof(raw)) {
+        fclose(file);
+        return false;
+    }
+
+    while (fread(raw, 1, recordSize, file) == recordSize) {
+        Record record = {
+            .type = raw[0],
+            .detail = raw[1],
+            .time = getF32(raw + 4),
+            .value = getF32(raw + 8),
+            .extra = getU32(raw + 12)
+        };
+        if (!appendRecord(&record)) {
+            fclose(file);
+            return false;
+        }
+    }
+
+    // Um registro cortado no fim (jogo fechado durante a escrita) é ignorado
+    fclose(file);
+    return true;
+}
+
+static int compareFloats(const void *a, const void *b) {
+    float x = *(const float *)a;
+    float y = *(const float *)b;
+    return (x > y) - (x < y);
+}
+
+static void frameBucketAdd(FrameBucket *bucket, float ms, bool spike) {
+    bucket->frames++;
+    bucket->sumMs += ms;
+    if (ms > bucket->worstMs) bucket->worstMs = ms;
+    if (spike) bucket->spikes++;
+}
+
+static void printBar(long value, long maxValue) {
+    int length = maxValue > 0 ? (int)((double)value * BAR_WIDTH / maxValue) : 0;
+    if (value > 0 && length == 0) length = 1;
+    for (int i = 0; i < length; i++) putchar('#');
+}
+
+static void printFrameBuckets(const char *title, const FrameBucket *buckets, int count, int step, const char *unit) {
+    printf("\n%s\n", title);
+    printf("  %-12s %10s %10s %10s %8s\n", "faixa", "frames", "média ms", "pior ms", "picos");
+    for (int i = 0; i < count; i++) {
+        const FrameBucket *bucket = &buckets[i];
+        if (bucket->frames == 0) continue;
+
+        char label[32];
+        if (i == count - 1) {
+            snprintf(label, sizeof(label), "%d+ %s", i * step, unit);
+        } else {
+            snprintf(label, sizeof(label), "%d-%d %s", i * step, (i + 1) * step - 1, unit);
+        }
+        printf("  %-12s %10ld %10.2f %10.2f %8ld\n", label, bucket->frames,
+               bucket->sumMs / bucket->frames, bucket->worstMs, bucket->spikes);
+    }
+}
+
+static const char *detailName(int type, int detail) {
+    static char buffer[16];
+    switch (type) {
+        case TELEMETRY_KILL:
+            if (detail < 5) return enemyNames[detail];
+            break;
+        case TELEMETRY_DAMAGE:
+            if (detail < 4) return damageNames[detail];
+            break;
+        case TELEMETRY_PICKUP:
+            if (detail < 3) return powerupNames[detail];
+            break;
+        case TELEMETRY_REWARD:
+            if (detail < 7) return rewardNames[detail];
+            break;
+        case TELEMETRY_BOSS_LAYER:
+            if (detail == 0) return "derrotado";
+            snprintf(buffer, sizeof(buffer), "camada %d", detail);
+            return buffer;
+    }
+    snprintf(buffer, sizeof(buffer), "%d", detail);
+    return buffer;
+}
+
+static bool isGameplayEvent(int type) {
+    return type == TELEMETRY_KILL || type == TELEMETRY_DAMAGE || type == TELEMETRY_PICKUP ||
+           type == TELEMETRY_BOSS_LAYER || type == TELEMETRY_REWARD;
+}
+
+// Para cada pico, conta os eventos de jogo a até window segundos dele na mesma
+// partida. Eventos e frames estão em ordem de tempo dentro da partida, então
+// uma janela deslizante com dois índices basta.
+static void correlateSpikes(float spikeMs, float window, long *aroundSpikes, long *spikeCount, double *gameplaySeconds) {
+    long runStart = 0;
+    while (runStart < recordCount) {
+        long runEnd = runStart + 1;
+        while (runEnd < recordCount && records[runEnd].type != TELEMETRY_RUN_START &&
+               records[runEnd].type != TELEMETRY_SESSION_START) {
+            runEnd++;
+        }
+
+        long low = runStart;
+        long high = runStart;
+        float lastTime = 0.0f;
+        for (long i = runStart; i < runEnd; i++) {
+            const Record *frame = &records[i];
+            if (frame->type != TELEMETRY_FRAME) continue;
+            lastTime = frame->time;
+            if (frame->value <= spikeMs) continue;
+
+            while (high < runEnd && records[high].time <= frame->time + window) high++;
+            while (low < high && records[low].time < frame->time - window) low++;
+
+            (*spikeCount)++;
+            for (long j = low; j < high; j++) {
+                if (isGameplayEvent(records[j].type)) aroundSpikes[records[j].type]++;
+            }
+        }
+        *gameplaySeconds += lastTime;
+
+        runStart = runEnd;
+    }
+}
+
+int main(int argc, char **argv) {
+    float spikeMs = 0.0f;
+    float window = 0.5f;
+    int firstFile = 1;
+
+    while (firstFile < argc && strncmp(argv[firstFile], "--", 2) == 0) {
+        if (strcmp(argv[firstFile], "--spike") == 0 && firstFile + 1 < argc) {
+            spikeMs = (float)atof(argv[firstFile + 1]);
+        } else if (strcmp(argv[firstFile], "--window") == 0 && firstFile + 1 < argc) {
+            window = (float)atof(argv[firstFile + 1]);
+        } else {
+            break;
+        }
+        firstFile += 2;
+    }
+
+    if (firstFile >= argc) {
+        fprintf(stderr, "Uso: %s [--spike ms] [--window s] <telemetry.bin> [mais arquivos...]\n", argv[0]);
+        return 1;
+    }
+
+    for (int i = firstFile; i < argc; i++) {
+        if (!loadFile(argv[i])) return 1;
+    }
+
+    // Primeira passada: contagens e mediana do tempo de frame
+    long frameCount = 0;
+    for (long i = 0; i < recordCount; i++) {
+        if (records[i].type == TELEMETRY_FRAME) frameCount++;
+    }
+
+    float *frameTimes = malloc((frameCount > 0 ? frameCount : 1) * sizeof(float));
+    if (!frameTimes) return 1;
+
+    long frameIndex = 0;
+    for (long i = 0; i < recordCount; i++) {
+        const Record *record = &records[i];
+        if (record->type == TELEMETRY_FRAME) frameTimes[frameIndex++] = record->value;
+        if (record->type == TELEMETRY_SESSION_START) sessions++;
+        if (record->type == TELEMETRY_RUN_START) runs++;
+        if (record->type == TELEMETRY_DROPPED) droppedTotal += record->extra;
+        if (record->type < EVENT_TYPE_COUNT) {
+            eventCounts[record->type][record->detail < DETAIL_COUNT ? record->detail : DETAIL_COUNT - 1]++;
+        }
+    }
+
+    printf("Sessões: %ld  Partidas: %ld  Frames: %ld  Registros descartados: %ld\n",
+           sessions, runs, frameCount, droppedTotal);
+
+    if (frameCount == 0) {
+        printf("Nenhum frame de partida gravado.\n");
+        free(frameTimes);
+        free(records);
+        return 0;
+    }
+
+    qsort(frameTimes, frameCount, sizeof(float), compareFloats);
+    float median = frameTimes[frameCount / 2];
+    if (spikeMs <= 0.0f) spikeMs = median * 2.0f;
+
+    printf("Tempo de frame: mediana %.2f ms  p95 %.2f ms  p99 %.2f ms  pior %.2f ms\n",
+           median, frameTimes[(long)(frameCount * 0.95)], frameTimes[(long)(frameCount * 0.99)],
+           frameTimes[frameCount - 1]);
+    printf("Pico: frame acima de %.2f ms\n", spikeMs);
+
+    // Segunda passada: histogramas de frame
+    for (long i = 0; i < recordCount; i++) {
+        const Record *record = &records[i];
+        if (record->type != TELEMETRY_FRAME) continue;
+
+        bool spike = record->value > spikeMs;
+        int bucket = (int)(record->value / HISTOGRAM_BUCKET_MS);
+        if (bucket < 0) bucket = 0;
+        if (bucket > HISTOGRAM_BUCKETS) bucket = HISTOGRAM_BUCKETS;
+        histogram[bucket]++;
+
+        int enemyBucket = (int)(record->extra / ENEMY_BUCKET_SIZE);
+        if (enemyBucket >= ENEMY_BUCKETS) enemyBucket = ENEMY_BUCKETS - 1;
+        frameBucketAdd(&byEnemies[enemyBucket], record->value, spike);
+
+        int minute = (int)(record->time / 60.0f);
+        if (minute < 0) minute = 0;
+        if (minute >= MINUTE_BUCKETS) minute = MINUTE_BUCKETS - 1;
+        frameBucketAdd(&byMinute[minute], record->value, spike);
+    }
+
+    long histogramMax = 0;
+    int firstBucket = HISTOGRAM_BUCKETS;
+    int lastBucket = 0;
+    for (int i = 0; i <= HISTOGRAM_BUCKETS; i++) {
+        if (histogram[i] == 0) continue;
+        if (histogram[i] > histogramMax) histogramMax = histogram[i];
+        if (i < firstBucket) firstBucket = i;
+        if (i > lastBucket) lastBucket = i;
+    }
+
+    printf("\nHistograma do tempo de frame (%.1f ms por linha)\n", HISTOGRAM_BUCKET_MS);
+    for (int i = firstBucket; i <= lastBucket; i++) {
+        if (histogram[i] == 0) continue;
+        if (i == HISTOGRAM_BUCKETS) {
+            printf("  %6.1f+      %8ld ", i * HISTOGRAM_BUCKET_MS, histogram[i]);
+        } else {
+            printf("  %6.1f-%-6.1f%8ld ", i * HISTOGRAM_BUCKET_MS, (i + 1) * HISTOGRAM_BUCKET_MS, histogram[i]);
+        }
+        printBar(histogram[i], histogramMax);
+        putchar('\n');
+    }
+
+    printFrameBuckets("Tempo de frame por inimigos vivos", byEnemies, ENEMY_BUCKETS, ENEMY_BUCKET_SIZE, "inim.");
+    printFrameBuckets("Tempo de frame por minuto de partida", byMinute, MINUTE_BUCKETS, 1, "min");
+
+    printf("\nEventos\n");
+    for (int type = TELEMETRY_KILL; type < EVENT_TYPE_COUNT; type++) {
+        if (!isGameplayEvent(type)) continue;
+        for (int detail = 0; detail < DETAIL_COUNT; detail++) {
+            if (eventCounts[type][detail] == 0) continue;
+            printf("  %-12s %-16s %8ld\n", eventNames[type], detailName(type, detail), eventCounts[type][detail]);
+        }
+    }
+
+    long aroundSpikes[EVENT_TYPE_COUNT] = { 0 };
+    long spikeCount = 0;
+    double gameplaySeconds = 0.0;
+    correlateSpikes(spikeMs, window, aroundSpikes, &spikeCount, &gameplaySeconds);
+
+    printf("\nEventos a até %.2f s de um pico (%ld picos)\n", window, spikeCount);
+    printf("  %-12s %12s %12s %8s\n", "evento", "por pico", "esperado", "razão");
+    for (int type = TELEMETRY_KILL; type < EVENT_TYPE_COUNT; type++) {
+        if (!isGameplayEvent(type) || spikeCount == 0 || gameplaySeconds <= 0.0) continue;
+
+        long total = 0;
+        for (int detail = 0; detail < DETAIL_COUNT; detail++) total += eventCounts[type][detail];
+
+        // Esperado: taxa média da partida vezes a largura da janela
+        double perSpike = (double)aroundSpikes[type] / spikeCount;
+        double expected = total / gameplaySeconds * (2.0 * window);
+        printf("  %-12s %12.3f %12.3f %8.2f\n", eventNames[type], perSpike, expected,
+               expected > 0.0 ? perSpike / expected : 0.0);
+    }
+
+    free(frameTimes);
+    free(records);
+    return 0;
+}